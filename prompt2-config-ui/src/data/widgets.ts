@@ -20,6 +20,12 @@ export const widgets: WidgetDef[] = [
   { token: 'Repo.name',           description: 'Repository name',               group: 'Repo', gitOnly: true },
   { token: 'Repo.branch_name',    description: 'Current branch name',           group: 'Repo', gitOnly: true },
   { token: 'Repo.rebase_active',  description: 'If interactive rebase is active', group: 'Repo', gitOnly: true },
+  { token: 'Repo.rebase_step',    description: 'Rebase progress, e.g. 3/7',     group: 'Repo', gitOnly: true },
+  { token: 'Repo.merge_active',   description: 'If merge is in progress',       group: 'Repo', gitOnly: true },
+  { token: 'Repo.cherry_pick_active', description: 'If cherry-pick is in progress', group: 'Repo', gitOnly: true },
+  { token: 'Repo.revert_active',  description: 'If revert is in progress',      group: 'Repo', gitOnly: true },
+  { token: 'Repo.bisect_active',  description: 'If bisect is in progress',      group: 'Repo', gitOnly: true },
+  { token: 'Repo.state',          description: 'What is in progress, e.g. MERGING', group: 'Repo', gitOnly: true },
   { token: 'Repo.conflicts',      description: 'Number of conflicts',           group: 'Repo', gitOnly: true },
   { token: 'Repo.ahead',          description: 'Commits ahead of upstream',     group: 'Repo', gitOnly: true },
   { token: 'Repo.behind',         description: 'Commits behind upstream',       group: 'Repo', gitOnly: true },
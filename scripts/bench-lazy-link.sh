@@ -0,0 +1,98 @@
+#!/usr/bin/env bash
+# bench-lazy-link.sh — compare the startup time of the regular build
+# of prompt2 with the LAZY_LINK=1 build, which only loads libgit2 and
+# json-c when a prompt needs them
+#
+# Builds both variants into a temporary directory, then draws a
+# prompt outside any repo, and in a repo with and without status
+# widgets. /bin/true is the floor.
+#
+# Usage:
+#   scripts/bench-lazy-link.sh [path/to/repo] [runs]
+#
+# Extra make arguments (e.g. INCLUDE_DIR=... LIB_DIR=...) can be passed
+# in MAKE_ARGS. Uses hyperfine if it's installed, otherwise a plain
+# timing loop.
+
+set -uo pipefail
+
+SCRIPT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+ROOT_DIR=$(cd "$SCRIPT_DIR/.." && pwd)
+REPO=$(cd "${1:-.}" && pwd)
+RUNS="${2:-100}"
+
+if ! git -C "$REPO" rev-parse --git-dir > /dev/null 2>&1; then
+  echo "'$REPO' is not a git repository" >&2
+  exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# ── Build both variants ────────────────────────────────────────────────────
+for variant in regular lazy; do
+  flags=()
+  [[ $variant == lazy ]] && flags=(LAZY_LINK=1)
+  # shellcheck disable=SC2086
+  if ! make -s -C "$ROOT_DIR" BUILD_DIR="$TMP/build-$variant" BIN_DIR="$TMP/$variant" \
+       "${flags[@]}" ${MAKE_ARGS:-} "$TMP/$variant/prompt2" > /dev/null; then
+    echo "building the $variant variant failed" >&2
+    exit 1
+  fi
+done
+
+mkdir "$TMP/not-a-repo"
+cat > "$TMP/head.ini" <<'INI'
+[PROMPT]
+prompt = "@{CWD} $ "
+
+[PROMPT.GIT]
+prompt = "@{Repo.name}:@{Repo.branch_name} @{CWD} $ "
+INI
+
+cat > "$TMP/status.ini" <<'INI'
+[PROMPT]
+prompt = "@{CWD} $ "
+
+[PROMPT.GIT]
+prompt = "@{Repo.name}:@{Repo.branch_name} @{Repo.staged}@{Repo.modified}@{Repo.untracked} @{CWD} $ "
+INI
+
+names=("/bin/true" "not a repo" "branch only" "branch and status")
+dirs=( "$TMP/not-a-repo" "$TMP/not-a-repo" "$REPO" "$REPO")
+configs=("" "$TMP/head.ini" "$TMP/head.ini" "$TMP/status.ini")
+
+# ── Benchmark ──────────────────────────────────────────────────────────────
+run_cmd() { # variant index
+  if [[ $2 -eq 0 ]]; then echo "/bin/true"
+  else echo "'$TMP/$1/prompt2' '${configs[$2]}'"
+  fi
+}
+
+if command -v hyperfine > /dev/null; then
+  for i in "${!names[@]}"; do
+    commands=()
+    for variant in regular lazy; do
+      [[ $i -eq 0 && $variant == lazy ]] && continue
+      commands+=(-n "$variant: ${names[$i]}" "cd '${dirs[$i]}' && $(run_cmd $variant "$i")")
+    done
+    hyperfine -N --warmup 5 --runs "$RUNS" "${commands[@]}" 2> /dev/null ||
+      hyperfine --warmup 5 --runs "$RUNS" "${commands[@]}"
+  done
+  exit
+fi
+
+for i in "${!names[@]}"; do
+  for variant in regular lazy; do
+    [[ $i -eq 0 && $variant == lazy ]] && continue
+    cmd=$(run_cmd $variant "$i")
+    cd "${dirs[$i]}" || exit 1
+    start=$EPOCHREALTIME # bash 5+
+    for ((n = 0; n < RUNS; n++)); do
+      eval "$cmd" > /dev/null 2>&1
+    done
+    end=$EPOCHREALTIME
+    awk -v name="$variant: ${names[$i]}" -v s="$start" -v e="$end" -v r="$RUNS" \
+      'BEGIN { printf "%-28s %8.2f ms/run\n", name, (e - s) * 1000 / r }'
+  done
+done
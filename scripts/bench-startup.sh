@@ -0,0 +1,72 @@
+#!/usr/bin/env bash
+# bench-startup.sh — measure how long prompt2 takes to draw a prompt
+#
+# Compares a git prompt which only shows the repo and branch name
+# (read straight from .git, no libgit2) with one which also shows the
+# status of the repo (libgit2), and with a directory outside any repo.
+#
+# Usage:
+#   scripts/bench-startup.sh [path/to/repo] [runs]
+#
+# Uses hyperfine if it's installed, otherwise a plain timing loop.
+
+set -uo pipefail
+
+SCRIPT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+PROMPT2="$SCRIPT_DIR/../bin/prompt2"
+REPO=$(cd "${1:-.}" && pwd)
+RUNS="${2:-50}"
+
+# ── Pre-flight ─────────────────────────────────────────────────────────────
+if [[ ! -x "$PROMPT2" ]]; then
+  echo "prompt2 not found at $PROMPT2 — run 'make build' first" >&2
+  exit 1
+fi
+if ! git -C "$REPO" rev-parse --git-dir > /dev/null 2>&1; then
+  echo "'$REPO' is not a git repository" >&2
+  exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/head.ini" <<'INI'
+[PROMPT]
+prompt = "@{CWD} $ "
+
+[PROMPT.GIT]
+prompt = "@{Repo.name}:@{Repo.branch_name} @{CWD} $ "
+INI
+
+cat > "$TMP/status.ini" <<'INI'
+[PROMPT]
+prompt = "@{CWD} $ "
+
+[PROMPT.GIT]
+prompt = "@{Repo.name}:@{Repo.branch_name} @{Repo.staged}@{Repo.modified}@{Repo.untracked} @{Repo.ahead}@{Repo.behind} @{CWD} $ "
+INI
+
+names=(  "branch only"    "branch and status" "not a repo")
+configs=("$TMP/head.ini" "$TMP/status.ini"   "$TMP/head.ini")
+dirs=(   "$REPO"          "$REPO"             "$TMP")
+
+# ── Benchmark ──────────────────────────────────────────────────────────────
+if command -v hyperfine > /dev/null; then
+  commands=()
+  for i in "${!names[@]}"; do
+    commands+=(-n "${names[$i]}" "cd '${dirs[$i]}' && '$PROMPT2' '${configs[$i]}'")
+  done
+  hyperfine --warmup 3 --runs "$RUNS" "${commands[@]}"
+  exit
+fi
+
+for i in "${!names[@]}"; do
+  cd "${dirs[$i]}" || exit 1
+  start=$EPOCHREALTIME # bash 5+
+  for ((n = 0; n < RUNS; n++)); do
+    "$PROMPT2" "${configs[$i]}" > /dev/null 2>&1
+  done
+  end=$EPOCHREALTIME
+  awk -v name="${names[$i]}" -v s="$start" -v e="$end" -v r="$RUNS" \
+    'BEGIN { printf "%-18s %8.2f ms/run\n", name, (e - s) * 1000 / r }'
+done
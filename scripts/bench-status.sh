@@ -0,0 +1,63 @@
+#!/usr/bin/env bash
+# bench-status.sh — compare the git status engines of prompt2
+#
+# Runs bin/test-get-status in a repository with the default engine
+# (git_status_list_new) and with the parallel working tree walk
+# ([SYSTEM] status_threads) at a few thread counts.
+#
+# Usage:
+#   scripts/bench-status.sh [path/to/repo] [runs]
+#
+# Uses hyperfine if it's installed, otherwise a plain timing loop.
+
+set -uo pipefail
+
+SCRIPT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+TEST_GET_STATUS="$SCRIPT_DIR/../bin/test-get-status"
+REPO="${1:-.}"
+RUNS="${2:-20}"
+THREADS="0 1 2 4 8 $(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 16)"
+
+# ── Pre-flight ─────────────────────────────────────────────────────────────
+if [[ ! -x "$TEST_GET_STATUS" ]]; then
+  echo "test-get-status not found at $TEST_GET_STATUS — run 'make build' first" >&2
+  exit 1
+fi
+cd "$REPO" || exit 1
+if ! git rev-parse --git-dir > /dev/null 2>&1; then
+  echo "'$REPO' is not a git repository" >&2
+  exit 1
+fi
+
+# ── Sanity check: every engine must count the same ─────────────────────────
+reference=$(PROMPT2_STATUS_THREADS=0 "$TEST_GET_STATUS" | grep -E '^Repo\.(staged|modified|untracked|conflicts) ')
+for n in $THREADS; do
+  result=$(PROMPT2_STATUS_THREADS=$n "$TEST_GET_STATUS" | grep -E '^Repo\.(staged|modified|untracked|conflicts) ')
+  if [[ "$result" != "$reference" ]]; then
+    echo "status_threads=$n disagrees with libgit2:" >&2
+    diff <(echo "$reference") <(echo "$result") >&2
+    exit 1
+  fi
+done
+echo "$reference"
+echo
+
+# ── Benchmark ──────────────────────────────────────────────────────────────
+if command -v hyperfine > /dev/null; then
+  commands=()
+  for n in $THREADS; do
+    commands+=(-n "status_threads=$n" "PROMPT2_STATUS_THREADS=$n $TEST_GET_STATUS")
+  done
+  hyperfine --warmup 3 --runs "$RUNS" "${commands[@]}"
+  exit
+fi
+
+for n in $THREADS; do
+  start=$EPOCHREALTIME # bash 5+
+  for ((i = 0; i < RUNS; i++)); do
+    PROMPT2_STATUS_THREADS=$n "$TEST_GET_STATUS" > /dev/null
+  done
+  end=$EPOCHREALTIME
+  awk -v n="$n" -v s="$start" -v e="$end" -v r="$RUNS" \
+    'BEGIN { printf "status_threads=%-3s %8.2f ms/run\n", n, (e - s) * 1000 / r }'
+done
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# gen-colour-tables.py — generate src/colour-depth-tables.h
+#
+# Writes the nearest-colour tables colour-depth.c downsamples colours
+# with:
+#
+#   - rgb_to_256: for each 24-bit colour, with 5 bits kept per
+#     channel, the nearest colour of the xterm 6x6x6 cube and grey
+#     ramp (16-255; 0-15 are left out, as every terminal has its own)
+#   - xterm256_to_16: for each of the 256 colours, the nearest of the
+#     16 basic ones (xterm's defaults); 0-15 are themselves
+#   - xterm256_rgb: the RGB values of the 256 colours, for colours
+#     given by their number
+#
+# "Nearest" is the "redmean" weighted distance, a cheap approximation
+# of how different two colours look.
+#
+# Usage:
+#   scripts/gen-colour-tables.py > src/colour-depth-tables.h
+
+BASIC = [
+    (0x00, 0x00, 0x00), (0xcd, 0x00, 0x00), (0x00, 0xcd, 0x00), (0xcd, 0xcd, 0x00),
+    (0x00, 0x00, 0xee), (0xcd, 0x00, 0xcd), (0x00, 0xcd, 0xcd), (0xe5, 0xe5, 0xe5),
+    (0x7f, 0x7f, 0x7f), (0xff, 0x00, 0x00), (0x00, 0xff, 0x00), (0xff, 0xff, 0x00),
+    (0x5c, 0x5c, 0xff), (0xff, 0x00, 0xff), (0x00, 0xff, 0xff), (0xff, 0xff, 0xff),
+]
+LEVELS = [0, 95, 135, 175, 215, 255]
+
+
+def xterm256():
+    """The RGB values of the 256 colours"""
+    palette = list(BASIC)
+    palette += [(LEVELS[r], LEVELS[g], LEVELS[b])
+                for r in range(6) for g in range(6) for b in range(6)]
+    palette += [(8 + 10 * i,) * 3 for i in range(24)]
+    return palette
+
+
+def distance(a, b):
+    rmean = (a[0] + b[0]) / 2
+    dr, dg, db = a[0] - b[0], a[1] - b[1], a[2] - b[2]
+    return (2 + rmean / 256) * dr * dr + 4 * dg * dg + (2 + (255 - rmean) / 256) * db * db
+
+
+def nearest(colour, palette, first):
+    return min(range(first, len(palette)), key=lambda i: distance(colour, palette[i]))
+
+
+def table(name, size, values):
+    print(f"static const unsigned char {name}[{size}] = {{")
+    for i in range(0, len(values), 16):
+        print("  " + " ".join(f"{v:3}," for v in values[i:i + 16]))
+    print("};")
+
+
+palette = xterm256()
+centre = [(i << 3) | 4 for i in range(32)]
+rgb_to_256 = [nearest((centre[r], centre[g], centre[b]), palette, 16)
+              for r in range(32) for g in range(32) for b in range(32)]
+xterm256_to_16 = list(range(16)) + [nearest(palette[i], BASIC, 0) for i in range(16, 256)]
+
+print("""/*
+  Generated by scripts/gen-colour-tables.py - do not edit
+*/
+#ifndef COLOUR_DEPTH_TABLES_H
+#define COLOUR_DEPTH_TABLES_H
+
+/**
+   The nearest of colours 16-255 to a 24-bit colour, indexed by
+   (r >> 3) << 10 | (g >> 3) << 5 | (b >> 3)
+*/""")
+table("rgb_to_256", 32 * 32 * 32, rgb_to_256)
+print("""
+/**
+   The nearest of the 16 basic colours to each of the 256 colours
+*/""")
+table("xterm256_to_16", 256, xterm256_to_16)
+print("""
+/**
+   The RGB values of the 256 colours
+*/""")
+print("static const unsigned char xterm256_rgb[256][3] = {")
+for i in range(0, 256, 4):
+    print("  " + " ".join("{{ {:3}, {:3}, {:3} }},".format(*c) for c in palette[i:i + 4]))
+print("};")
+print("""
+#endif //COLOUR_DEPTH_TABLES_H""")
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# gen-display-width.py — generate src/display-width-tables.h
+#
+# Writes the tables of zero width and double width code points which
+# display-width.c looks code points up in, from the Unicode database
+# of the Python running it, with the same rules as wcwidth():
+#
+#   - zero width: nonspacing and enclosing marks (Mn, Me), format
+#     characters (Cf) except the soft hyphen, and the Hangul Jamo
+#     medial vowels and final consonants
+#   - double width: East Asian Wide and Fullwidth characters (which
+#     include the emoji shown as emoji by default), and the unassigned
+#     code points of the CJK planes
+#
+# Usage:
+#   scripts/gen-display-width.py > src/display-width-tables.h
+
+import sys
+import unicodedata
+
+
+def ranges(predicate):
+    """The code points for which predicate is true, as [first, last] ranges"""
+    result = []
+    for cp in range(0x80, sys.maxunicode + 1):
+        if predicate(cp):
+            if result and result[-1][1] == cp - 1:
+                result[-1][1] = cp
+            else:
+                result.append([cp, cp])
+    return result
+
+
+def is_zero_width(cp):
+    if 0x1160 <= cp <= 0x11FF:
+        return True
+    if cp == 0x00AD:
+        return False
+    return unicodedata.category(chr(cp)) in ('Mn', 'Me', 'Cf')
+
+
+def is_double_width(cp):
+    if 0x20000 <= cp <= 0x2FFFD or 0x30000 <= cp <= 0x3FFFD:
+        return True
+    return unicodedata.east_asian_width(chr(cp)) in ('W', 'F')
+
+
+def table(name, rows):
+    print(f"static const struct CodepointRange {name}[] = {{")
+    for i in range(0, len(rows), 4):
+        print("  " + " ".join(f"{{ 0x{a:05X}, 0x{b:05X} }}," for a, b in rows[i:i + 4]))
+    print("};")
+
+
+print(f"""/*
+  Generated by scripts/gen-display-width.py from Unicode {unicodedata.unidata_version}
+  - do not edit
+*/
+#ifndef DISPLAY_WIDTH_TABLES_H
+#define DISPLAY_WIDTH_TABLES_H
+""")
+table("zero_width", ranges(is_zero_width))
+print()
+table("double_width", ranges(is_double_width))
+print("""
+#endif //DISPLAY_WIDTH_TABLES_H""")
@@ -0,0 +1,2154 @@
+/*
+  Generated by scripts/gen-colour-tables.py - do not edit
+*/
+#ifndef COLOUR_DEPTH_TABLES_H
+#define COLOUR_DEPTH_TABLES_H
+
+/**
+   The nearest of colours 16-255 to a 24-bit colour, indexed by
+   (r >> 3) << 10 | (g >> 3) << 5 | (b >> 3)
+*/
+static const unsigned char rgb_to_256[32768] = {
+   16, 232, 232, 232, 233, 233, 233,  17,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  232, 232, 232, 233, 233, 233, 234,  17,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  232, 233, 233, 233, 233, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 233, 234, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 234, 234, 234, 234, 235, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 234, 234, 234, 234, 235, 235, 235, 235, 236, 236,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22, 235, 235, 235, 235, 236, 236, 236,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22, 235, 236, 236, 236,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 236,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  232, 232, 232, 233, 233, 233, 233,  17,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  232, 232, 233, 233, 233, 233, 234,  17,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  232, 233, 233, 233, 234, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 234, 234, 234, 234, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 234, 234, 234, 234, 235, 235, 235, 236,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 234, 235, 235, 235, 235, 236, 236, 236,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22, 235, 235, 235, 235, 236, 236, 236, 236, 237,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22, 235, 236, 236, 236, 236, 237,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 236, 237,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  232, 232, 232, 233, 233, 233, 234,  17,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  232, 233, 233, 233, 233, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 233, 234, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 234, 234, 234, 234, 235, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 234, 234, 234, 234, 235, 235, 235, 235, 236, 236,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22, 236, 236, 236, 236, 237, 237, 237,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22, 236, 236, 237, 237,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 237, 237,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  232, 232, 233, 233, 233, 233, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 233, 234, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 234, 234, 234, 234, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 234, 234, 234, 235, 235, 235, 235, 236,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 234, 235, 235, 235, 235, 236, 236, 236,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22, 236, 236, 236, 236, 237, 237, 237, 237, 238,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22, 236, 236, 237, 237, 237, 237, 238,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 237, 237, 237,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 237, 238,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  232, 233, 233, 233, 233, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 233, 234, 234, 234, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 234, 234, 234, 234, 235, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 234, 234, 234, 234, 235, 235, 235, 235, 236, 236,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+  235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22, 236, 237, 237, 237, 237, 238, 238, 238, 238,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22, 237, 237, 237, 238, 238, 238,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 238, 238, 238, 238,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 238, 238,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  233, 233, 233, 233, 234, 234, 234, 234,  17,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 233, 233, 234, 234, 234, 234, 235, 235,  17,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  233, 234, 234, 234, 234, 235, 235, 235, 235, 236,  17,  17,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236,  17,  17,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 237, 237, 237, 237,  18,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238,  18,
+   18,  18,  18,  19,  19,  19,  19,  19,  20,  20,  20,  20,  20,  21,  21,  21,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+  235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+  235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22, 236, 237, 237, 237, 237, 238, 238, 238, 238, 238, 239, 239,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22, 237, 238, 238, 238, 238, 239, 239, 239,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 238, 238, 239, 239, 239,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   22,  22,  22,  22,  22, 238, 239, 239, 239,  23,  23,  23,  23,  23,  24,  24,
+   24,  24,  24,  25,  25,  25,  25,  25,  26,  26,  26,  26,  26,  27,  27,  27,
+   28,  28,  28,  28,  28,  28, 239,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   28,  28,  28,  28,  28,  28,  29,  29,  29,  29,  29,  29,  29,  29,  30,  30,
+   30,  30,  30,  31,  31,  31,  31,  31,  32,  32,  32,  32,  32,  33,  33,  33,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   34,  34,  34,  34,  34,  34,  35,  35,  35,  35,  35,  35,  35,  35,  36,  36,
+   36,  36,  36,  37,  37,  37,  37,  37,  38,  38,  38,  38,  38,  39,  39,  39,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   40,  40,  40,  40,  40,  40,  41,  41,  41,  41,  41,  41,  41,  41,  42,  42,
+   42,  42,  42,  43,  43,  43,  43,  43,  44,  44,  44,  44,  44,  45,  45,  45,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+   46,  46,  46,  46,  46,  46,  47,  47,  47,  47,  47,  47,  47,  47,  48,  48,
+   48,  48,  48,  49,  49,  49,  49,  49,  50,  50,  50,  50,  50,  51,  51,  51,
+  233, 233, 233, 233, 234, 234, 234, 235,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  233, 233, 234, 234, 234, 234, 235, 235, 235,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  233, 234, 234, 234, 234, 235, 235, 235, 235, 236,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  234, 234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+  235, 236, 236, 236, 236, 237, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+  236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 239, 239, 239, 239, 239, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64, 239, 239, 239, 240, 240,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52, 234, 234, 234, 234,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52, 234, 234, 234, 235, 235, 235,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  234, 234, 234, 234, 235, 235, 235, 235, 236,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  234, 234, 235, 235, 235, 235, 236, 236, 236, 236, 237,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  234, 235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+  235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 238, 238, 238, 238, 239, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 238, 239, 239, 239, 239, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 240, 240, 240, 240,  59,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64, 239, 240, 240,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52, 234,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52, 235, 235, 235,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52, 234, 235, 235, 235, 235, 236, 236,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52, 234, 235, 235, 235, 235, 236, 236, 236, 236,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58, 237, 237, 237, 237, 238, 238, 238, 238, 238, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 239, 239, 239, 239, 240, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240,  59,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 240, 240, 240, 240,  59,  59, 241,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64, 240, 240,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52, 235,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52, 235, 235, 236, 236,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52, 235, 235, 235, 236, 236, 236, 236,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52, 235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  236, 236, 236, 236, 237, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 240, 240, 240, 240,  59,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240, 240, 240,  59,  59, 241, 241, 241,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64, 240,  65,  65,  65,  65,  65,  65, 242, 242,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52, 236, 236,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52, 235, 236, 236, 236, 236,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52, 235, 236, 236, 236, 236, 237, 237, 237, 237,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+  235, 236, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   58, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 239, 239, 239, 239, 239, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 238, 239, 239, 239, 239, 240, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240,  59,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 240, 240, 240, 240,  59,  59, 241, 241,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240, 240,  59,  59, 241, 241, 241, 242,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64, 240,  65,  65,  65,  65,  65, 241, 242, 242,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52, 236, 236, 236, 237,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52, 236, 236, 236, 237, 237, 237, 237,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52, 236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   58,  58, 236, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 237, 238, 238, 238, 238, 238, 239, 239, 239, 239, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 239, 239, 239, 239, 239, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 240, 240, 240,  59,  59, 241,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240, 240, 240,  59,  59, 241, 241, 241,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240,  59,  59, 241, 241, 241, 242, 242,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65, 241, 242, 242, 242, 242,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52, 236, 237,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52, 236, 237, 237, 237, 237,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52, 236, 237, 237, 237, 237, 238, 238, 238, 238, 238, 239, 239,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   58,  58, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58, 237, 238, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 238, 239, 239, 239, 239, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 240, 240, 240, 240,  59,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 240, 240, 240,  59,  59,  59, 241, 241,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240, 240,  59,  59, 241, 241, 241, 242,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240,  59,  59, 241, 241, 241, 242, 242, 242, 242,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65, 241, 242, 242, 242, 242, 243,
+  243,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65, 243,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52,  52,  53,  53,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52,  52,  52, 237, 237, 237,  53,  53,  53,  53,  53,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   52,  52,  52, 237, 237, 237, 237, 238, 238, 238, 238, 239, 239,  53,  54,  54,
+   54,  54,  54,  55,  55,  55,  55,  55,  56,  56,  56,  56,  56,  57,  57,  57,
+   58,  58,  58, 237, 237, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58, 238, 238, 239, 239, 239, 239, 240, 240, 240, 240,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 239, 239, 240, 240, 240, 240,  59,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58, 239, 239, 240, 240, 240, 240,  59,  59, 241,  60,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240, 240,  59,  59,  59, 241, 241, 242,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58, 240, 240,  59,  59, 241, 241, 241, 242, 242,  60,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   58,  58,  58,  58,  58,  58,  59,  59, 241, 241, 241, 242, 242, 242, 242, 242,
+   60,  60,  60,  61,  61,  61,  61,  61,  62,  62,  62,  62,  62,  63,  63,  63,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65, 242, 242, 242, 242, 243, 243,
+  243, 243,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65, 243, 243, 243,
+  243,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65, 243,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   64,  64,  64,  64,  64,  64,  65,  65,  65,  65,  65,  65,  65,  65,  66,  66,
+   66,  66,  66,  67,  67,  67,  67,  67,  68,  68,  68,  68,  68,  69,  69,  69,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   70,  70,  70,  70,  70,  70,  71,  71,  71,  71,  71,  71,  71,  71,  72,  72,
+   72,  72,  72,  73,  73,  73,  73,  73,  74,  74,  74,  74,  74,  75,  75,  75,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  77,  77,  77,  77,  78,  78,
+   78,  78,  78,  79,  79,  79,  79,  79,  80,  80,  80,  80,  80,  81,  81,  81,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   82,  82,  82,  82,  82,  82,  83,  83,  83,  83,  83,  83,  83,  83,  84,  84,
+   84,  84,  84,  85,  85,  85,  85,  85,  86,  86,  86,  86,  86,  87,  87,  87,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88, 237, 237,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88, 237, 237, 238, 238, 238, 238, 239, 239,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   94,  94,  94,  94, 238, 238, 238, 238, 239, 239, 239, 239, 239, 240, 240,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94, 238, 238, 238, 239, 239, 239, 239, 240, 240, 240,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94, 239, 239, 239, 239, 239, 240, 240, 240,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94, 239, 239, 239, 240, 240, 240,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94, 240, 240, 240,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94, 240, 240,  95,  95,  95,  95, 241, 242, 242,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95, 241, 242, 242, 242, 242,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95, 241, 242, 242, 242, 242, 242, 243,
+  243,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 242, 242, 242, 242, 243, 243, 243,
+  243, 243, 244, 244, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 243, 243, 243, 243,
+  244, 244, 244, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 243, 244, 244,
+  244, 244, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  244, 102, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 102,
+  102, 245, 245, 245, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 245, 246, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88, 238, 238, 238, 238,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   94,  94,  94,  94,  94, 238, 238, 239, 239, 239, 239,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94, 238, 239, 239, 239,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94, 239,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95, 242,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95, 242, 242, 243, 243,
+  243,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 242, 243, 243, 243, 243,
+  243, 244, 244, 244, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 243, 243, 244,
+  244, 244, 244, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  244, 102, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  102, 102, 245, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 102, 102,
+  245, 245, 245, 246, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 245, 246, 246, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   94,  94,  94,  94,  94,  94, 239,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95, 243, 243,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 243, 243, 243, 243,
+  244, 244, 244, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 243, 244, 244,
+  244, 244, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  102, 102, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 102,
+  102, 245, 245, 245, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 102, 245,
+  245, 245, 246, 246, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  245, 246, 246, 246, 246, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95, 243,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 243, 243, 244,
+  244, 244, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  244, 102, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 102,
+  102, 102, 245, 245, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 102, 102,
+  245, 245, 245, 246, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 245, 245,
+  245, 246, 246, 246, 246, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 245,
+  246, 246, 246, 246, 247, 247, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 247, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   88,  88,  88,  88,  88,  88,  89,  89,  89,  89,  89,  89,  89,  89,  90,  90,
+   90,  90,  90,  91,  91,  91,  91,  91,  92,  92,  92,  92,  92,  93,  93,  93,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+   94,  94,  94,  94,  94,  94,  95,  95,  95,  95,  95,  95,  95,  95,  96,  96,
+   96,  96,  96,  97,  97,  97,  97,  97,  98,  98,  98,  98,  98,  99,  99,  99,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  244, 102, 102, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 244, 244,
+  102, 102, 245, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 102, 102,
+  245, 245, 245, 246, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 102, 245,
+  245, 245, 246, 246, 103, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 245, 245,
+  246, 246, 246, 246, 246, 103, 103, 103, 104, 104, 104, 104, 104, 105, 105, 105,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 245, 246,
+  246, 246, 246, 247, 247, 247, 247, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 247, 247, 247, 247, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 247, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107, 108, 108,
+  108, 108, 108, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 111, 111, 111,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 114, 114,
+  114, 114, 114, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 117, 117, 117,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120,
+  120, 120, 120, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 244, 244,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 245, 246, 246, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 245,
+  245, 246, 246, 246, 246, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 245, 246,
+  246, 246, 246, 246, 247, 247, 247, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 246, 246,
+  246, 246, 247, 247, 247, 247, 247, 248, 248, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 247, 247, 247, 247, 248, 248, 248, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 247, 248, 248, 248, 248, 248, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 248, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 145, 145, 145, 249, 249, 146, 146, 146, 146, 147, 147, 147,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 250, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 246, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 246, 246, 247, 247, 247, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  246, 247, 247, 247, 247, 247, 248, 248, 248, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 247, 247, 248, 248, 248, 248, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 248, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 145, 145, 249, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 145, 145, 249, 249, 249, 249, 146, 146, 146, 146, 147, 147, 147,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 250, 250, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 247, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 247, 247, 247, 247, 248, 248, 248, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 247, 248, 248, 248, 248, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 145, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 145, 145, 249, 249, 249, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 145, 249, 249, 249, 250, 250, 146, 146, 146, 146, 147, 147, 147,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 249, 250, 250, 250, 250, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 247, 248, 248, 248, 248, 248, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 248, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 145, 145, 145, 249, 249, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 145, 145, 249, 249, 249, 250, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 249, 249, 249, 250, 250, 250, 250, 146, 146, 146, 147, 147, 147,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 250, 250, 250, 250, 250, 251, 251, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 251, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+  126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131, 131, 132, 132,
+  132, 132, 132, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+  138, 138, 138, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 248, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 248, 248, 145, 145, 249, 146, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 145, 145, 249, 249, 249, 249, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 145, 249, 249, 249, 250, 250, 146, 146, 146, 146, 147, 147, 147,
+  142, 142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 143, 143, 143, 144, 144,
+  144, 144, 144, 249, 249, 250, 250, 250, 250, 250, 251, 146, 146, 147, 147, 147,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 250, 250, 250, 250, 250, 251, 251, 251, 251, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 251, 251, 251, 251, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 251, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  148, 148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 149, 149, 149, 150, 150,
+  150, 150, 150, 151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 156, 156,
+  156, 156, 156, 157, 157, 157, 157, 157, 158, 158, 158, 158, 158, 159, 159, 159,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 248, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 249, 250, 250, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 249, 249, 250, 250, 250, 250, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 249, 250, 250, 250, 250, 250, 251, 251, 251, 182, 183, 183, 183,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 250, 250, 250, 250, 251, 251, 251, 251, 251, 252, 252, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 251, 251, 251, 251, 252, 252, 252, 252, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 251, 252, 252, 252, 252, 252, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 252, 188, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 188, 188, 188, 253, 253, 189, 189,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 250, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 250, 250, 251, 251, 251, 182, 182, 183, 183, 183,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 250, 251, 251, 251, 251, 251, 252, 252, 252, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 251, 251, 252, 252, 252, 252, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 252, 252, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 188, 188, 253, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 188, 188, 253, 253, 253, 253, 189, 189,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 254, 254, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 251, 182, 182, 182, 182, 183, 183, 183,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 251, 251, 251, 251, 252, 252, 252, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 252, 252, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 188, 188, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 188, 188, 188, 253, 253, 253, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 188, 253, 253, 253, 253, 254, 189, 189,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 253, 254, 254, 254, 254, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 251, 252, 252, 252, 252, 252, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 252, 188, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 188, 188, 188, 253, 253, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 188, 188, 253, 253, 253, 254, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 253, 253, 253, 254, 254, 254, 254, 189,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 254, 254, 254, 254, 254, 254, 255,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 255, 195, 195,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 195, 195, 195,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161, 162, 162,
+  162, 162, 162, 163, 163, 163, 163, 163, 164, 164, 164, 164, 164, 165, 165, 165,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  166, 166, 166, 166, 166, 166, 167, 167, 167, 167, 167, 167, 167, 167, 168, 168,
+  168, 168, 168, 169, 169, 169, 169, 169, 170, 170, 170, 170, 170, 171, 171, 171,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  172, 172, 172, 172, 172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 174, 174,
+  174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 176, 177, 177, 177,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179, 180, 180,
+  180, 180, 180, 181, 181, 181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 252, 252, 188, 188, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 252, 188, 188, 188, 253, 189, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 188, 188, 253, 253, 253, 253, 189, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 253, 253, 253, 253, 254, 254, 254, 189,
+  184, 184, 184, 184, 184, 184, 185, 185, 185, 185, 185, 185, 185, 185, 186, 186,
+  186, 186, 186, 187, 187, 187, 187, 187, 253, 253, 254, 254, 254, 254, 254, 255,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 254, 254, 254, 254, 254, 255, 255, 255,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 255, 255, 255, 255,
+  190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192,
+  192, 192, 192, 193, 193, 193, 193, 193, 194, 194, 194, 194, 194, 255, 195, 195,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 252, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 253, 254, 254, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 253, 254, 254, 254, 254, 254, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 254, 254, 254, 254, 254, 254, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 254, 254, 254, 254, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 255, 255, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 230, 255, 255, 255, 231,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 254, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 254, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 255, 255, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 230, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 230, 230, 255, 231, 231,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  196, 196, 196, 196, 196, 196, 197, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+  198, 198, 198, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 201, 201, 201,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  202, 202, 202, 202, 202, 202, 203, 203, 203, 203, 203, 203, 203, 203, 204, 204,
+  204, 204, 204, 205, 205, 205, 205, 205, 206, 206, 206, 206, 206, 207, 207, 207,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209, 210, 210,
+  210, 210, 210, 211, 211, 211, 211, 211, 212, 212, 212, 212, 212, 213, 213, 213,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216,
+  216, 216, 216, 217, 217, 217, 217, 217, 218, 218, 218, 218, 218, 219, 219, 219,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 225, 225, 225,
+  220, 220, 220, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 222, 222,
+  222, 222, 222, 223, 223, 223, 223, 223, 224, 224, 224, 224, 224, 255, 225, 225,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 255, 255, 255, 255, 255,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 230, 230, 255, 231, 231,
+  226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227, 228, 228,
+  228, 228, 228, 229, 229, 229, 229, 229, 230, 230, 230, 230, 230, 231, 231, 231,
+};
+
+/**
+   The nearest of the 16 basic colours to each of the 256 colours
+*/
+static const unsigned char xterm256_to_16[256] = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+    0,   0,   4,   4,   4,   4,   0,   8,   8,  12,  12,  12,   2,   8,   6,   6,
+    6,  12,   2,   2,   6,   6,   6,   6,   2,   2,   6,   6,   6,  14,  10,  10,
+    6,   6,  14,  14,   0,   0,   5,   4,   4,   4,   8,   8,   8,   8,  12,  12,
+    2,   8,   8,   8,  12,  12,   2,   8,   8,   8,   6,  12,   2,   8,   8,   6,
+    6,  14,  10,  10,   6,   6,  14,  14,   1,   1,   5,   5,   5,   5,   8,   8,
+    8,   8,  12,  12,   3,   8,   8,   8,  12,  12,   3,   8,   8,   8,   8,  12,
+    3,   8,   8,   7,   7,   7,   3,   3,   7,   7,   7,   7,   1,   1,   5,   5,
+    5,   5,   1,   8,   8,   8,  12,  12,   3,   8,   8,   8,   8,  12,   3,   8,
+    8,   8,   7,   7,   3,   3,   7,   7,   7,   7,   3,   3,   7,   7,   7,   7,
+    1,   1,   5,   5,   5,  13,   1,   8,   8,   8,   5,  12,   3,   8,   8,   8,
+    7,   7,   3,   3,   8,   7,   7,   7,   3,   3,   7,   7,   7,   7,  11,  11,
+    7,   7,   7,  15,   9,   9,   5,   5,  13,  13,   9,   8,   8,   5,  13,  13,
+    3,   3,   8,   7,   7,   7,   3,   3,   7,   7,   7,   7,  11,  11,   7,   7,
+    7,   7,  11,  11,   7,   7,  15,  15,   0,   0,   0,   0,   0,   0,   8,   8,
+    8,   8,   8,   8,   8,   8,   8,   8,   8,   7,   7,   7,   7,   7,   7,   7,
+};
+
+/**
+   The RGB values of the 256 colours
+*/
+static const unsigned char xterm256_rgb[256][3] = {
+  {   0,   0,   0 }, { 205,   0,   0 }, {   0, 205,   0 }, { 205, 205,   0 },
+  {   0,   0, 238 }, { 205,   0, 205 }, {   0, 205, 205 }, { 229, 229, 229 },
+  { 127, 127, 127 }, { 255,   0,   0 }, {   0, 255,   0 }, { 255, 255,   0 },
+  {  92,  92, 255 }, { 255,   0, 255 }, {   0, 255, 255 }, { 255, 255, 255 },
+  {   0,   0,   0 }, {   0,   0,  95 }, {   0,   0, 135 }, {   0,   0, 175 },
+  {   0,   0, 215 }, {   0,   0, 255 }, {   0,  95,   0 }, {   0,  95,  95 },
+  {   0,  95, 135 }, {   0,  95, 175 }, {   0,  95, 215 }, {   0,  95, 255 },
+  {   0, 135,   0 }, {   0, 135,  95 }, {   0, 135, 135 }, {   0, 135, 175 },
+  {   0, 135, 215 }, {   0, 135, 255 }, {   0, 175,   0 }, {   0, 175,  95 },
+  {   0, 175, 135 }, {   0, 175, 175 }, {   0, 175, 215 }, {   0, 175, 255 },
+  {   0, 215,   0 }, {   0, 215,  95 }, {   0, 215, 135 }, {   0, 215, 175 },
+  {   0, 215, 215 }, {   0, 215, 255 }, {   0, 255,   0 }, {   0, 255,  95 },
+  {   0, 255, 135 }, {   0, 255, 175 }, {   0, 255, 215 }, {   0, 255, 255 },
+  {  95,   0,   0 }, {  95,   0,  95 }, {  95,   0, 135 }, {  95,   0, 175 },
+  {  95,   0, 215 }, {  95,   0, 255 }, {  95,  95,   0 }, {  95,  95,  95 },
+  {  95,  95, 135 }, {  95,  95, 175 }, {  95,  95, 215 }, {  95,  95, 255 },
+  {  95, 135,   0 }, {  95, 135,  95 }, {  95, 135, 135 }, {  95, 135, 175 },
+  {  95, 135, 215 }, {  95, 135, 255 }, {  95, 175,   0 }, {  95, 175,  95 },
+  {  95, 175, 135 }, {  95, 175, 175 }, {  95, 175, 215 }, {  95, 175, 255 },
+  {  95, 215,   0 }, {  95, 215,  95 }, {  95, 215, 135 }, {  95, 215, 175 },
+  {  95, 215, 215 }, {  95, 215, 255 }, {  95, 255,   0 }, {  95, 255,  95 },
+  {  95, 255, 135 }, {  95, 255, 175 }, {  95, 255, 215 }, {  95, 255, 255 },
+  { 135,   0,   0 }, { 135,   0,  95 }, { 135,   0, 135 }, { 135,   0, 175 },
+  { 135,   0, 215 }, { 135,   0, 255 }, { 135,  95,   0 }, { 135,  95,  95 },
+  { 135,  95, 135 }, { 135,  95, 175 }, { 135,  95, 215 }, { 135,  95, 255 },
+  { 135, 135,   0 }, { 135, 135,  95 }, { 135, 135, 135 }, { 135, 135, 175 },
+  { 135, 135, 215 }, { 135, 135, 255 }, { 135, 175,   0 }, { 135, 175,  95 },
+  { 135, 175, 135 }, { 135, 175, 175 }, { 135, 175, 215 }, { 135, 175, 255 },
+  { 135, 215,   0 }, { 135, 215,  95 }, { 135, 215, 135 }, { 135, 215, 175 },
+  { 135, 215, 215 }, { 135, 215, 255 }, { 135, 255,   0 }, { 135, 255,  95 },
+  { 135, 255, 135 }, { 135, 255, 175 }, { 135, 255, 215 }, { 135, 255, 255 },
+  { 175,   0,   0 }, { 175,   0,  95 }, { 175,   0, 135 }, { 175,   0, 175 },
+  { 175,   0, 215 }, { 175,   0, 255 }, { 175,  95,   0 }, { 175,  95,  95 },
+  { 175,  95, 135 }, { 175,  95, 175 }, { 175,  95, 215 }, { 175,  95, 255 },
+  { 175, 135,   0 }, { 175, 135,  95 }, { 175, 135, 135 }, { 175, 135, 175 },
+  { 175, 135, 215 }, { 175, 135, 255 }, { 175, 175,   0 }, { 175, 175,  95 },
+  { 175, 175, 135 }, { 175, 175, 175 }, { 175, 175, 215 }, { 175, 175, 255 },
+  { 175, 215,   0 }, { 175, 215,  95 }, { 175, 215, 135 }, { 175, 215, 175 },
+  { 175, 215, 215 }, { 175, 215, 255 }, { 175, 255,   0 }, { 175, 255,  95 },
+  { 175, 255, 135 }, { 175, 255, 175 }, { 175, 255, 215 }, { 175, 255, 255 },
+  { 215,   0,   0 }, { 215,   0,  95 }, { 215,   0, 135 }, { 215,   0, 175 },
+  { 215,   0, 215 }, { 215,   0, 255 }, { 215,  95,   0 }, { 215,  95,  95 },
+  { 215,  95, 135 }, { 215,  95, 175 }, { 215,  95, 215 }, { 215,  95, 255 },
+  { 215, 135,   0 }, { 215, 135,  95 }, { 215, 135, 135 }, { 215, 135, 175 },
+  { 215, 135, 215 }, { 215, 135, 255 }, { 215, 175,   0 }, { 215, 175,  95 },
+  { 215, 175, 135 }, { 215, 175, 175 }, { 215, 175, 215 }, { 215, 175, 255 },
+  { 215, 215,   0 }, { 215, 215,  95 }, { 215, 215, 135 }, { 215, 215, 175 },
+  { 215, 215, 215 }, { 215, 215, 255 }, { 215, 255,   0 }, { 215, 255,  95 },
+  { 215, 255, 135 }, { 215, 255, 175 }, { 215, 255, 215 }, { 215, 255, 255 },
+  { 255,   0,   0 }, { 255,   0,  95 }, { 255,   0, 135 }, { 255,   0, 175 },
+  { 255,   0, 215 }, { 255,   0, 255 }, { 255,  95,   0 }, { 255,  95,  95 },
+  { 255,  95, 135 }, { 255,  95, 175 }, { 255,  95, 215 }, { 255,  95, 255 },
+  { 255, 135,   0 }, { 255, 135,  95 }, { 255, 135, 135 }, { 255, 135, 175 },
+  { 255, 135, 215 }, { 255, 135, 255 }, { 255, 175,   0 }, { 255, 175,  95 },
+  { 255, 175, 135 }, { 255, 175, 175 }, { 255, 175, 215 }, { 255, 175, 255 },
+  { 255, 215,   0 }, { 255, 215,  95 }, { 255, 215, 135 }, { 255, 215, 175 },
+  { 255, 215, 215 }, { 255, 215, 255 }, { 255, 255,   0 }, { 255, 255,  95 },
+  { 255, 255, 135 }, { 255, 255, 175 }, { 255, 255, 215 }, { 255, 255, 255 },
+  {   8,   8,   8 }, {  18,  18,  18 }, {  28,  28,  28 }, {  38,  38,  38 },
+  {  48,  48,  48 }, {  58,  58,  58 }, {  68,  68,  68 }, {  78,  78,  78 },
+  {  88,  88,  88 }, {  98,  98,  98 }, { 108, 108, 108 }, { 118, 118, 118 },
+  { 128, 128, 128 }, { 138, 138, 138 }, { 148, 148, 148 }, { 158, 158, 158 },
+  { 168, 168, 168 }, { 178, 178, 178 }, { 188, 188, 188 }, { 198, 198, 198 },
+  { 208, 208, 208 }, { 218, 218, 218 }, { 228, 228, 228 }, { 238, 238, 238 },
+};
+
+#endif //COLOUR_DEPTH_TABLES_H
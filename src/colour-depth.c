@@ -0,0 +1,141 @@
+/*
+ * colour-depth.c
+ *
+ * Downsamples colours for terminals which can't show 24-bit colour,
+ * such as some over SSH, or an older tmux: most of the named colours
+ * are 24-bit, and so is fg-rgb-R;G;B. The nearest colours are looked
+ * up in tables generated by scripts/gen-colour-tables.py, and the
+ * attributes are only rendered once per configuration, so this costs
+ * nothing per prompt.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "colour-depth.h"
+#include "colour-depth-tables.h"
+#include "constants.h"
+
+/**
+   Max number of parameters of an SGR sequence which are downsampled
+*/
+#define SGR_MAX_PARAMS 32
+
+
+/**
+ * Look up a colour depth by name.
+ */
+int colour_depth_lookup(const char *name, enum colour_depth *depth) {
+  if (strcasecmp(name, "auto") == 0) {
+    *depth = detect_colour_depth();
+  }
+  else if (strcasecmp(name, "truecolor") == 0 || strcasecmp(name, "24bit") == 0) {
+    *depth = COLOUR_DEPTH_TRUECOLOR;
+  }
+  else if (strcmp(name, "256") == 0) {
+    *depth = COLOUR_DEPTH_256;
+  }
+  else if (strcmp(name, "16") == 0) {
+    *depth = COLOUR_DEPTH_16;
+  }
+  else {
+    return FAILURE;
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * Work out the colour depth of the terminal.
+ */
+enum colour_depth detect_colour_depth(void) {
+  const char *colorterm = getenv("COLORTERM");
+  if (colorterm && (strcmp(colorterm, "truecolor") == 0 || strcmp(colorterm, "24bit") == 0)) {
+    return COLOUR_DEPTH_TRUECOLOR;
+  }
+
+  const char *term = getenv("TERM");
+  if (term == NULL || term[0] == '\0') return COLOUR_DEPTH_TRUECOLOR; // don't know
+  if (strstr(term, "direct"))          return COLOUR_DEPTH_TRUECOLOR; // e.g. xterm-direct
+  if (strstr(term, "256color"))        return COLOUR_DEPTH_256;
+  return COLOUR_DEPTH_16;
+}
+
+
+/**
+ * Helper: One of the 16 basic colours as an SGR parameter, for the
+ * foreground (38) or the background (48)
+ */
+int __basic_colour_param(int layer, int index) {
+  int base = (layer == 48) ? 40 : 30;
+  return index < 8 ? base + index : base + 60 + index - 8;
+}
+
+/**
+ * Helper: A colour channel, clamped to 0-255
+ */
+int __channel(const char *param) {
+  int value = atoi(param);
+  return value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+
+/**
+ * Downsample the colours of an SGR sequence to a colour depth.
+ */
+int downsample_sgr(const char *params, enum colour_depth depth, char *result, size_t result_size) {
+  // split the parameters (a copy of them) on ';'
+  char copy[512];
+  if (snprintf(copy, sizeof(copy), "%s", params) >= (int) sizeof(copy)) return FAILURE;
+  char *param[SGR_MAX_PARAMS];
+  size_t count = 0;
+  char *rest = copy;
+  char *token;
+  while ((token = strsep(&rest, ";")) != NULL && count < SGR_MAX_PARAMS) {
+    param[count++] = token;
+  }
+
+  size_t used = 0;
+  result[0] = '\0';
+  for (size_t i = 0; i < count; i++) {
+    char downsampled[16] = "";
+    int layer = atoi(param[i]);
+
+    if ((layer == 38 || layer == 48) && i + 4 < count && strcmp(param[i + 1], "2") == 0 &&
+        depth != COLOUR_DEPTH_TRUECOLOR) {
+      int r = __channel(param[i + 2]), g = __channel(param[i + 3]), b = __channel(param[i + 4]);
+      int index = rgb_to_256[(r >> 3) << 10 | (g >> 3) << 5 | (b >> 3)];
+      if (depth == COLOUR_DEPTH_256) {
+        snprintf(downsampled, sizeof(downsampled), "%d;5;%d", layer, index);
+      }
+      else {
+        snprintf(downsampled, sizeof(downsampled), "%d", __basic_colour_param(layer, xterm256_to_16[index]));
+      }
+      i += 4;
+    }
+    else if ((layer == 38 || layer == 48) && i + 2 < count && strcmp(param[i + 1], "5") == 0 &&
+             depth == COLOUR_DEPTH_16) {
+      int index = __channel(param[i + 2]);
+      snprintf(downsampled, sizeof(downsampled), "%d", __basic_colour_param(layer, xterm256_to_16[index]));
+      i += 2;
+    }
+
+    const char *out = downsampled[0] ? downsampled : param[i];
+    int written = snprintf(result + used, result_size - used, "%s%s", used ? ";" : "", out);
+    if (written < 0 || (size_t) written >= result_size - used) return FAILURE;
+    used += written;
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * The RGB values of one of the 256 colours.
+ */
+void xterm256_colour_rgb(unsigned char index, int rgb[3]) {
+  for (int i = 0; i < 3; i++) {
+    rgb[i] = xterm256_rgb[index][i];
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef COLOURDEPTH_H
+#define COLOURDEPTH_H
+/*
+  header file for colour-depth.c
+*/
+#include <stddef.h>
+
+
+/**
+ * How many colours a terminal can show.
+ */
+enum colour_depth {
+  COLOUR_DEPTH_TRUECOLOR = 0, // 38;2;r;g;b, as the attributes are written
+  COLOUR_DEPTH_256       = 1, // 38;5;n
+  COLOUR_DEPTH_16        = 2, // 30-37 and 90-97
+};
+
+
+/**
+ * Look up a colour depth by name, as in `[SYSTEM] colour_depth`:
+ * "truecolor" (or "24bit"), "256", "16", or "auto" for
+ * detect_colour_depth().
+ *
+ * @param depth  Set to the colour depth, if the name is known.
+ * @return SUCCESS, or FAILURE if the name isn't known
+ */
+int colour_depth_lookup(const char *name, enum colour_depth *depth);
+
+
+/**
+ * Work out the colour depth of the terminal from $COLORTERM and
+ * $TERM. Without $TERM, colours are left as they are written.
+ */
+enum colour_depth detect_colour_depth(void);
+
+
+/**
+ * Downsample the colours of an SGR sequence (its parameters, such as
+ * "1;38;2;255;128;0") to a colour depth, with the nearest colours in
+ * the tables generated by scripts/gen-colour-tables.py. Other
+ * parameters are copied as they are.
+ *
+ * @param result  Set to the parameters.
+ * @return SUCCESS, or FAILURE if they don't fit result
+ */
+int downsample_sgr(const char *params, enum colour_depth depth, char *result, size_t result_size);
+
+
+/**
+ * The RGB values of one of the 256 colours (as in 38;5;n), with
+ * xterm's defaults for the 16 basic ones.
+ *
+ * @param rgb  Set to the values, 0-255.
+ */
+void xterm256_colour_rgb(unsigned char index, int rgb[3]);
+
+
+#endif //COLOURDEPTH_H
@@ -0,0 +1,301 @@
+/*
+ * colour-index.c
+ *
+ * Finds the names of colours: the attributes with an SGR code, and
+ * the nearest of the named 24-bit colours to any colour, such as one
+ * from the palette of a design system.
+ *
+ * The named colours are kept in a k-d tree, built the first time
+ * it's needed. Each range of the colours is sorted by red, green or
+ * blue in turn and split at its middle, so the tree is the array
+ * itself. Finding the nearest colour then only visits a few of the
+ * ~500 of them.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "attributes.h"
+#include "colour-depth.h"
+#include "colour-index.h"
+#include "constants.h"
+
+
+/**
+   The named colours, as a k-d tree, and their names
+*/
+static struct NamedColour *colours = NULL;
+static size_t              colour_count = 0;
+static const char        **names = NULL;
+
+/**
+   A named colour in the attributes, while the index is built
+*/
+struct ColourEntry {
+  int    rgb[3];
+  size_t index; // in the attributes
+};
+
+/**
+   The least each of red, green and blue counts for in __distance()
+*/
+static const double axis_weight[3] = { 2, 4, 2 };
+
+
+/**
+ * Helper: How different two colours look: the "redmean" weighted
+ * distance, as in scripts/gen-colour-tables.py
+ */
+double __distance(const int a[3], const int b[3]) {
+  double rmean = (a[0] + b[0]) / 2.0;
+  int dr = a[0] - b[0], dg = a[1] - b[1], db = a[2] - b[2];
+  return (2 + rmean / 256) * dr * dr + 4 * dg * dg + (2 + (255 - rmean) / 256) * db * db;
+}
+
+/**
+ * Helpers: Compare colours by red, green or blue, for qsort()
+ */
+int __compare_red(const void *a, const void *b) {
+  return ((const struct NamedColour *) a)->rgb[0] - ((const struct NamedColour *) b)->rgb[0];
+}
+int __compare_green(const void *a, const void *b) {
+  return ((const struct NamedColour *) a)->rgb[1] - ((const struct NamedColour *) b)->rgb[1];
+}
+int __compare_blue(const void *a, const void *b) {
+  return ((const struct NamedColour *) a)->rgb[2] - ((const struct NamedColour *) b)->rgb[2];
+}
+
+/**
+ * Helper: Compare colour entries by their colour, then by where they
+ * are in the attributes, for qsort()
+ */
+int __compare_entries(const void *a, const void *b) {
+  const struct ColourEntry *x = a, *y = b;
+  for (int i = 0; i < 3; i++) {
+    if (x->rgb[i] != y->rgb[i]) return x->rgb[i] - y->rgb[i];
+  }
+  return (x->index > y->index) - (x->index < y->index);
+}
+
+
+/**
+ * Helper: Make a range of the colours a k-d tree, split on red,
+ * green or blue at the depth
+ */
+void __build_tree(size_t lo, size_t hi, int depth) {
+  static int (*const compare[3])(const void *, const void *) = {
+    __compare_red, __compare_green, __compare_blue,
+  };
+  if (hi - lo < 2) return;
+  qsort(colours + lo, hi - lo, sizeof(struct NamedColour), compare[depth % 3]);
+  size_t mid = lo + (hi - lo) / 2;
+  __build_tree(lo, mid, depth + 1);
+  __build_tree(mid + 1, hi, depth + 1);
+}
+
+/**
+ * Helper: Index the named colours of the attributes, the fg- ones
+ * (the bg- ones are the same colours)
+ * @return SUCCESS, or FAILURE if out of memory
+ */
+int __build_index(void) {
+  size_t count = 0;
+  for (size_t i = 0; attributes[i].name != NULL; i++) count++;
+
+  struct ColourEntry *entries = malloc(count * sizeof(struct ColourEntry));
+  names   = malloc(count * sizeof(const char *));
+  colours = malloc(count * sizeof(struct NamedColour));
+  if (!entries || !names || !colours) {
+    free(entries);
+    free_colour_index();
+    return FAILURE;
+  }
+
+  size_t entry_count = 0;
+  for (size_t i = 0; attributes[i].name != NULL; i++) {
+    struct ColourEntry *entry = &entries[entry_count];
+    if (strncmp(attributes[i].name, "fg-", 3) == 0 &&
+        sscanf(attributes[i].code, "38;2;%d;%d;%d", &entry->rgb[0], &entry->rgb[1], &entry->rgb[2]) == 3) {
+      entry->index = i;
+      entry_count++;
+    }
+  }
+
+  // a colour for each RGB value, with all of its names
+  qsort(entries, entry_count, sizeof(struct ColourEntry), __compare_entries);
+  for (size_t i = 0; i < entry_count; i++) {
+    names[i] = attributes[entries[i].index].name;
+    if (i == 0 || memcmp(entries[i].rgb, entries[i - 1].rgb, sizeof(entries[i].rgb)) != 0) {
+      struct NamedColour *colour = &colours[colour_count++];
+      memcpy(colour->rgb, entries[i].rgb, sizeof(colour->rgb));
+      colour->names = &names[i];
+      colour->count = 0;
+    }
+    colours[colour_count - 1].count++;
+  }
+  free(entries);
+
+  __build_tree(0, colour_count, 0);
+  return SUCCESS;
+}
+
+/**
+ * Free the index of the named colours.
+ */
+void free_colour_index(void) {
+  free(colours);
+  free(names);
+  colours = NULL;
+  names = NULL;
+  colour_count = 0;
+}
+
+
+/**
+ * Helper: Look for a colour nearer than the best so far in a range
+ * of the k-d tree. The other side of a split is only looked at if a
+ * colour there could be nearer.
+ */
+void __search(size_t lo, size_t hi, int depth, const int rgb[3],
+              const struct NamedColour **best, double *best_distance) {
+  if (lo >= hi) return;
+  size_t mid = lo + (hi - lo) / 2;
+  const struct NamedColour *colour = &colours[mid];
+
+  double distance = __distance(colour->rgb, rgb);
+  if (distance < *best_distance) {
+    *best_distance = distance;
+    *best = colour;
+  }
+
+  int axis = depth % 3;
+  int diff = rgb[axis] - colour->rgb[axis];
+  if (diff < 0) {
+    __search(lo, mid, depth + 1, rgb, best, best_distance);
+    if (axis_weight[axis] * diff * diff < *best_distance) {
+      __search(mid + 1, hi, depth + 1, rgb, best, best_distance);
+    }
+  }
+  else {
+    __search(mid + 1, hi, depth + 1, rgb, best, best_distance);
+    if (axis_weight[axis] * diff * diff < *best_distance) {
+      __search(lo, mid, depth + 1, rgb, best, best_distance);
+    }
+  }
+}
+
+/**
+ * The named colour nearest to an RGB colour.
+ */
+const struct NamedColour *nearest_named_colour(const int rgb[3]) {
+  if (colours == NULL && __build_index() != SUCCESS) return NULL;
+
+  const struct NamedColour *best = NULL;
+  double best_distance = 1e12;
+  __search(0, colour_count, 0, rgb, &best, &best_distance);
+  return best;
+}
+
+
+/**
+ * Helper: The SGR code of a query, without the `\[`, `\e[` (or
+ * `\033[`, or the escape character) and `m\]` around it, if it's an
+ * escape sequence
+ */
+void __sgr_code(const char *query, char *code, size_t code_size) {
+  static const char *intros[] = { "\\e[", "\\033[", "\033[" };
+  if (strncmp(query, "\\[", 2) == 0) query += 2;
+  int is_escape = 0;
+  for (size_t i = 0; i < sizeof(intros) / sizeof(intros[0]); i++) {
+    if (strncmp(query, intros[i], strlen(intros[i])) == 0) {
+      query += strlen(intros[i]);
+      is_escape = 1;
+      break;
+    }
+  }
+  snprintf(code, code_size, "%s", query);
+
+  size_t length = strlen(code);
+  if (length >= 2 && strcmp(code + length - 2, "\\]") == 0) code[length -= 2] = '\0';
+  if (is_escape && length >= 1 && code[length - 1] == 'm') code[--length] = '\0';
+}
+
+/**
+ * Helper: Parse a colour: "#rrggbb", "r,g,b", or as SGR parameters,
+ * "38;2;r;g;b" or "38;5;n" (or 48 for the background)
+ * @param layer  Set to 48 for a background colour, 38 otherwise.
+ * @return SUCCESS, or FAILURE if it isn't a colour
+ */
+int __parse_colour(const char *code, int rgb[3], int *layer) {
+  int end = -1, index = 0;
+  *layer = 38;
+
+  if (code[0] == '#' && strlen(code) == 7 && strspn(code + 1, "0123456789abcdefABCDEF") == 6) {
+    sscanf(code + 1, "%2x%2x%2x", (unsigned *) &rgb[0], (unsigned *) &rgb[1], (unsigned *) &rgb[2]);
+    return SUCCESS;
+  }
+  if (sscanf(code, "%d , %d , %d%n", &rgb[0], &rgb[1], &rgb[2], &end) == 3 && code[end] == '\0') {
+    // r,g,b
+  }
+  else if (sscanf(code, "%d;2;%d;%d;%d%n", layer, &rgb[0], &rgb[1], &rgb[2], &end) == 4 && code[end] == '\0') {
+    // 38;2;r;g;b
+  }
+  else if (sscanf(code, "%d;5;%d%n", layer, &index, &end) == 2 && code[end] == '\0' &&
+           index >= 0 && index < 256) {
+    xterm256_colour_rgb((unsigned char) index, rgb);
+  }
+  else {
+    return FAILURE;
+  }
+
+  if (*layer != 38 && *layer != 48) return FAILURE;
+  for (int i = 0; i < 3; i++) {
+    if (rgb[i] < 0 || rgb[i] > 255) return FAILURE;
+  }
+  return SUCCESS;
+}
+
+/**
+ * Helper: Append a name to a list of names
+ * @return SUCCESS, or FAILURE if it doesn't fit
+ */
+int __append_name(char *result, size_t result_size, size_t *used, const char *prefix, const char *name) {
+  int written = snprintf(result + *used, result_size - *used, "%s%s%s", *used ? ", " : "", prefix, name);
+  if (written < 0 || (size_t) written >= result_size - *used) return FAILURE;
+  *used += written;
+  return SUCCESS;
+}
+
+/**
+ * Look up the names of a colour, or of another attribute.
+ */
+int colour_names(const char *query, char *result, size_t result_size) {
+  char code[64];
+  __sgr_code(query, code, sizeof(code));
+  size_t used = 0;
+  result[0] = '\0';
+
+  // the attributes with the code
+  for (size_t i = 0; attributes[i].name != NULL; i++) {
+    if (strcmp(attributes[i].code, code) == 0 &&
+        __append_name(result, result_size, &used, "", attributes[i].name) != SUCCESS) {
+      return FAILURE;
+    }
+  }
+  if (used > 0) return SUCCESS;
+
+  // or the nearest named colour
+  int rgb[3], layer;
+  if (__parse_colour(code, rgb, &layer) != SUCCESS) return FAILURE;
+  const struct NamedColour *nearest = nearest_named_colour(rgb);
+  if (nearest == NULL) return FAILURE;
+  for (size_t i = 0; i < nearest->count; i++) {
+    if (__append_name(result, result_size, &used, layer == 48 ? "bg-" : "fg-",
+                      nearest->names[i] + 3) != SUCCESS) {
+      return FAILURE;
+    }
+  }
+  return SUCCESS;
+}
@@ -0,0 +1,53 @@
+#ifndef COLOURINDEX_H
+#define COLOURINDEX_H
+/*
+  header file for colour-index.c
+*/
+#include <stddef.h>
+
+
+/**
+ * A colour of the named 24-bit colours among the attributes, with
+ * all of its names (such as "fg-grey50" and "fg-gray50"). Each has a
+ * "bg-" name too.
+ */
+struct NamedColour {
+  int          rgb[3];
+  const char **names; // the "fg-" ones
+  size_t       count;
+};
+
+
+/**
+ * The named colour nearest to an RGB colour, by the same "redmean"
+ * distance the colours are downsampled with.
+ *
+ * @param rgb  The colour, 0-255 for each of red, green and blue.
+ * @return the nearest colour, or NULL if there are none
+ */
+const struct NamedColour *nearest_named_colour(const int rgb[3]);
+
+
+/**
+ * Look up the names of a colour, or of another attribute:
+ * - an SGR code, or escape sequence, of an attribute gives every
+ *   attribute with that code, e.g. "34" or "\[\e[34m\]" gives
+ *   "fg blue, fg c4"
+ * - any other colour - "#rrggbb", "r,g,b", "38;2;r;g;b" or
+ *   "38;5;n" - gives the names of the nearest named colour; "bg-"
+ *   ones for a background colour (48;...), "fg-" ones otherwise
+ *
+ * @param result  Set to the names, separated by ", ".
+ * @return SUCCESS, or FAILURE if the query isn't a colour or code, or
+ *         the names don't fit result
+ */
+int colour_names(const char *query, char *result, size_t result_size);
+
+
+/**
+ * Free the index nearest_named_colour() builds when first used.
+ */
+void free_colour_index(void);
+
+
+#endif //COLOURINDEX_H
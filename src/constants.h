@@ -44,4 +44,23 @@ enum file_related_return_values {
 */
 #define SHORT_STRING           16
 
+
+/**
+ * The modification time of a struct stat, to the nanosecond
+ */
+#ifdef __APPLE__
+#define STAT_MTIME(st) ((st)->st_mtimespec)
+#else
+#define STAT_MTIME(st) ((st)->st_mtim)
+#endif
+
+/**
+ * The inode change time of a struct stat, to the nanosecond
+ */
+#ifdef __APPLE__
+#define STAT_CTIME(st) ((st)->st_ctimespec)
+#else
+#define STAT_CTIME(st) ((st)->st_ctim)
+#endif
+
 #endif // ENUM_H
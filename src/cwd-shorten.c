@@ -0,0 +1,337 @@
+/*
+ * cwd-shorten.c
+ *
+ * Ways of shortening the working directory which keep it readable:
+ * rather than cutting the path off at the left, which often leaves
+ * part of a directory, they cut down the directories on the left one
+ * at a time, and leave the last one as it is.
+ *
+ * For the unique prefixes, the directories next to each one have to
+ * be listed. They are kept, by the directory they are in, until it
+ * changes, so a prompt in the same place doesn't list them again.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <uthash.h>
+#ifdef __unix__
+#include <linux/limits.h> // For PATH_MAX
+#elif __APPLE__
+#include <sys/syslimits.h> // For PATH_MAX
+#endif
+
+#include "constants.h"
+#include "cwd-shorten.h"
+#include "display-width.h"
+#include "prompt2-utils.h"
+#include "render-cache.h"
+
+/**
+   Max number of directories of a path which are shortened
+*/
+#define CWD_MAX_DIRS      256
+
+/**
+   Max number of directories whose listings are kept
+*/
+#define CWD_LISTINGS_MAX  64
+
+
+/**
+   The directories in a directory, as last listed
+*/
+struct DirListing {
+  char           *path;  // the key
+  struct timespec mtime; // of the directory when it was listed
+  char          **names;
+  size_t          count;
+  UT_hash_handle  hh;
+};
+static struct DirListing *listings = NULL;
+static size_t listing_count = 0;
+
+/**
+   A path split into its directories, which point into it
+*/
+struct PathDirs {
+  const char *dir[CWD_MAX_DIRS];
+  size_t      length[CWD_MAX_DIRS];
+  size_t      count;
+};
+
+
+/**
+ * Look up a way of shortening by name.
+ */
+int cwd_shorten_lookup(const char *name, enum cwd_shorten *strategy) {
+  static const char *names[] = {
+    [CWD_SHORTEN_ELLIPSIS]   = "ellipsis",
+    [CWD_SHORTEN_FISH]       = "fish",
+    [CWD_SHORTEN_FIRST_LAST] = "first_last",
+    [CWD_SHORTEN_UNIQUE]     = "unique",
+  };
+  for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    if (strcmp(name, names[i]) == 0) {
+      *strategy = (enum cwd_shorten) i;
+      return SUCCESS;
+    }
+  }
+  return FAILURE;
+}
+
+
+/**
+ * Helper: Free a DirListing
+ */
+void __free_listing(struct DirListing *listing) {
+  for (size_t i = 0; i < listing->count; i++) {
+    free(listing->names[i]);
+  }
+  free(listing->names);
+  free(listing->path);
+  free(listing);
+}
+
+/**
+ * Forget the directories listed for CWD_SHORTEN_UNIQUE.
+ */
+void cwd_shorten_clear_cache(void) {
+  struct DirListing *listing, *tmp;
+  HASH_ITER(hh, listings, listing, tmp) {
+    HASH_DEL(listings, listing);
+    __free_listing(listing);
+  }
+  listing_count = 0;
+}
+
+/**
+ * Helper: The directories in a directory, listed again if it has
+ * changed since it was last listed
+ * @return the listing, or NULL if it can't be listed
+ */
+const struct DirListing *__list_directory(const char *path) {
+  struct stat st;
+  if (stat(path, &st) != 0) return NULL;
+
+  struct DirListing *listing;
+  HASH_FIND_STR(listings, path, listing);
+  if (listing &&
+      listing->mtime.tv_sec  == STAT_MTIME(&st).tv_sec &&
+      listing->mtime.tv_nsec == STAT_MTIME(&st).tv_nsec) {
+    return listing;
+  }
+  if (listing) {
+    HASH_DEL(listings, listing);
+    __free_listing(listing);
+    listing_count--;
+  }
+
+  DIR *dir = opendir(path);
+  if (dir == NULL) return NULL;
+  if (listing_count >= CWD_LISTINGS_MAX) cwd_shorten_clear_cache();
+
+  // a partial listing would make prefixes look unique which aren't,
+  // so without memory for all of it the directory stays as it is
+  listing = calloc(1, sizeof(struct DirListing));
+  if (listing == NULL || (listing->path = strdup(path)) == NULL) {
+    free(listing);
+    closedir(dir);
+    return NULL;
+  }
+  listing->mtime = STAT_MTIME(&st);
+  size_t size = 0;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    if (entry->d_type != DT_DIR && entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN) continue;
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+    if (listing->count == size) {
+      size = size ? size * 2 : 16;
+      char **names = realloc(listing->names, size * sizeof(char *));
+      if (names == NULL) break;
+      listing->names = names;
+    }
+    if ((listing->names[listing->count] = strdup(entry->d_name)) == NULL) break;
+    listing->count++;
+  }
+  closedir(dir);
+  if (entry != NULL) {
+    __free_listing(listing);
+    return NULL;
+  }
+
+  HASH_ADD_KEYPTR(hh, listings, listing->path, strlen(listing->path), listing);
+  listing_count++;
+  return listing;
+}
+
+
+/**
+ * Fold the directories above full_path into a fingerprint.
+ */
+uint64_t cwd_shorten_fingerprint(uint64_t fingerprint, const char *full_path) {
+  char parent[PATH_MAX];
+  snprintf(parent, sizeof(parent), "%s", full_path);
+
+  char *slash;
+  while ((slash = strrchr(parent, '/')) != NULL) {
+    slash[slash == parent ? 1 : 0] = '\0'; // keep the "/" of the root
+    struct stat st;
+    if (stat(parent, &st) == 0) {
+      fingerprint = fingerprint_int(fingerprint, STAT_MTIME(&st).tv_sec);
+      fingerprint = fingerprint_int(fingerprint, STAT_MTIME(&st).tv_nsec);
+    }
+    else {
+      fingerprint = fingerprint_int(fingerprint, -1);
+    }
+    if (slash == parent) break;
+  }
+  return fingerprint;
+}
+
+
+/**
+ * Helper: Split a path into its directories. An absolute path starts
+ * with an empty one.
+ */
+void __split_path(const char *path, struct PathDirs *dirs) {
+  dirs->count = 0;
+  while (dirs->count < CWD_MAX_DIRS) {
+    const char *slash = strchr(path, '/');
+    dirs->dir[dirs->count] = path;
+    dirs->length[dirs->count] = slash ? (size_t) (slash - path) : strlen(path);
+    dirs->count++;
+    if (!slash) break;
+    path = slash + 1;
+  }
+}
+
+/**
+ * Helper: The length in bytes of the first code points of a name:
+ * one, or two if it starts with a '.'
+ */
+size_t __first_letters(const char *name, size_t length) {
+  size_t letters = name[0] == '.' ? 2 : 1;
+  size_t i = 0;
+  while (i < length && letters > 0) {
+    i++;
+    while (i < length && (name[i] & 0xC0) == 0x80) i++; // the rest of the code point
+    letters--;
+  }
+  return i;
+}
+
+/**
+ * Helper: The length in bytes of the shortest prefix of a name which
+ * no other directory in the listing starts with
+ */
+size_t __unique_prefix(const char *name, size_t length, const struct DirListing *siblings) {
+  size_t prefix = 1;
+  for (size_t i = 0; i < siblings->count; i++) {
+    const char *sibling = siblings->names[i];
+    size_t common = 0;
+    while (common < length && sibling[common] == name[common]) common++;
+    if (common == length && sibling[common] == '\0') continue; // the directory itself
+    if (common + 1 > prefix) prefix = common + 1;
+  }
+  if (prefix > length) prefix = length;
+  while (prefix < length && (name[prefix] & 0xC0) == 0x80) prefix++;
+  return prefix;
+}
+
+/**
+ * Helper: How short a directory of the cwd can be for
+ * CWD_SHORTEN_UNIQUE. It's found in the full path by counting from
+ * the end; the first directory of the cwd may not be there (`~` or
+ * `+`), and is then left as it is.
+ */
+size_t __unique_length(const struct PathDirs *dirs, size_t i, const char *full_path) {
+  struct PathDirs full;
+  __split_path(full_path, &full);
+  if (full.count + i < dirs->count) return dirs->length[i];
+
+  size_t j = full.count - dirs->count + i;
+  if (j == 0 || full.length[j] != dirs->length[i] ||
+      strncmp(full.dir[j], dirs->dir[i], dirs->length[i]) != 0) {
+    return dirs->length[i];
+  }
+
+  char parent[PATH_MAX];
+  size_t parent_length = full.dir[j] - full_path - 1;
+  snprintf(parent, sizeof(parent), "%.*s", (int) parent_length, parent_length ? full_path : "/");
+  const struct DirListing *siblings = __list_directory(parent);
+  return siblings ? __unique_prefix(dirs->dir[i], dirs->length[i], siblings) : dirs->length[i];
+}
+
+
+/**
+ * Helper: Cut the directories on the left down to their first
+ * letters, or their unique prefixes, until the cwd fits
+ */
+void __abbreviate_dirs(char *cwd, int max_width, enum cwd_shorten strategy, const char *full_path) {
+  char copy[PATH_MAX];
+  snprintf(copy, sizeof(copy), "%s", cwd);
+  struct PathDirs dirs;
+  __split_path(copy, &dirs);
+
+  int width = display_width(copy, strlen(copy));
+  for (size_t i = 0; i + 1 < dirs.count && width > max_width; i++) {
+    size_t keep = (strategy == CWD_SHORTEN_UNIQUE && full_path)
+      ? __unique_length(&dirs, i, full_path)
+      : __first_letters(dirs.dir[i], dirs.length[i]);
+    if (keep < dirs.length[i]) {
+      width -= display_width(dirs.dir[i], dirs.length[i]) - display_width(dirs.dir[i], keep);
+      dirs.length[i] = keep;
+    }
+  }
+
+  size_t length = 0;
+  for (size_t i = 0; i < dirs.count; i++) {
+    length += sprintf(cwd + length, "%s%.*s", i ? "/" : "", (int) dirs.length[i], dirs.dir[i]);
+  }
+}
+
+/**
+ * Helper: Leave out the directories between the first and the last
+ * few, with fewer of the last ones if that doesn't fit
+ */
+void __keep_first_last(char *cwd, int max_width, int keep) {
+  char copy[PATH_MAX];
+  snprintf(copy, sizeof(copy), "%s", cwd);
+  struct PathDirs dirs;
+  __split_path(copy, &dirs);
+  if (keep < 1) keep = 1;
+  if (dirs.count < (size_t) keep + 2) return; // nothing to leave out
+
+  for (; keep >= 1; keep--) {
+    size_t length = sprintf(cwd, "%.*s/...", (int) dirs.length[0], dirs.dir[0]);
+    for (size_t i = dirs.count - keep; i < dirs.count; i++) {
+      length += sprintf(cwd + length, "/%.*s", (int) dirs.length[i], dirs.dir[i]);
+    }
+    if (display_width(cwd, length) <= max_width) return;
+  }
+}
+
+
+/**
+ * Shortens a working directory to max_width terminal columns.
+ */
+void shorten_cwd(char *cwd, int max_width, const struct CwdShortening *how, const char *full_path) {
+  if (display_width(cwd, strlen(cwd)) <= max_width) return;
+
+  switch (how->strategy) {
+  case CWD_SHORTEN_FISH:
+  case CWD_SHORTEN_UNIQUE:
+    __abbreviate_dirs(cwd, max_width, how->strategy, full_path);
+    break;
+  case CWD_SHORTEN_FIRST_LAST:
+    __keep_first_last(cwd, max_width, how->keep);
+    break;
+  case CWD_SHORTEN_ELLIPSIS:
+    break;
+  }
+  shorten_path(cwd, max_width); // if it still doesn't fit
+}
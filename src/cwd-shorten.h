@@ -0,0 +1,77 @@
+#ifndef CWDSHORTEN_H
+#define CWDSHORTEN_H
+/*
+  header file for cwd-shorten.c
+*/
+
+#include <stdint.h>
+
+
+/**
+ * The ways @{CWD} can be shortened when it doesn't fit, e.g. for
+ * ~/projects/mine/src
+ */
+enum cwd_shorten {
+  CWD_SHORTEN_ELLIPSIS   = 0, // "...mine/src": as much of the end as fits
+  CWD_SHORTEN_FISH       = 1, // "~/p/m/src": directories cut to their first letter
+  CWD_SHORTEN_FIRST_LAST = 2, // "~/.../mine/src": the first and the last few
+  CWD_SHORTEN_UNIQUE     = 3, // "~/pr/m/src": directories cut to a prefix unique in their parent
+};
+
+
+/**
+ * How @{CWD} is shortened, as in `cwd_shorten` and `cwd_keep`.
+ */
+struct CwdShortening {
+  enum cwd_shorten strategy;
+  int              keep; // for CWD_SHORTEN_FIRST_LAST: the last directories kept
+};
+
+
+/**
+ * Look up a way of shortening by name: "ellipsis", "fish",
+ * "first_last" or "unique".
+ *
+ * @param strategy  Set to the way, if the name is known.
+ * @return SUCCESS, or FAILURE if the name isn't known
+ */
+int cwd_shorten_lookup(const char *name, enum cwd_shorten *strategy);
+
+
+/**
+ * Shortens a working directory, as shown (e.g. "~/projects/src"), to
+ * max_width terminal columns in a pass over its directories: the
+ * ones on the left are cut down one at a time until it fits, the last
+ * one is left as it is. If that isn't enough, it's shortened with
+ * shorten_path() after all.
+ *
+ * @param cwd        The working directory to shorten, in place.
+ * @param how        How to shorten it.
+ * @param full_path  The absolute path of the working directory, for
+ *                   CWD_SHORTEN_UNIQUE to list the directories of;
+ *                   cwd must end the same way.
+ */
+void shorten_cwd(char *cwd, int max_width, const struct CwdShortening *how, const char *full_path);
+
+
+/**
+ * Fold what CWD_SHORTEN_UNIQUE reads from the file system into a
+ * fingerprint: the modification times of the directories above
+ * full_path, whose listings the unique prefixes come from. A prompt
+ * remembered from before a directory was added next to one of them
+ * then isn't used again.
+ *
+ * @param fingerprint  The fingerprint so far.
+ * @param full_path    The absolute path of the working directory.
+ * @return the new fingerprint
+ */
+uint64_t cwd_shorten_fingerprint(uint64_t fingerprint, const char *full_path);
+
+
+/**
+ * Forget the directories listed for CWD_SHORTEN_UNIQUE.
+ */
+void cwd_shorten_clear_cache(void);
+
+
+#endif //CWDSHORTEN_H
@@ -0,0 +1,186 @@
+/*
+ * display-width.c
+ *
+ * How many columns text takes up in a terminal. Prompts are mostly
+ * ASCII, so runs of ASCII are counted (16 bytes at a time, where
+ * SSE2 is available) without decoding them; everything else is
+ * decoded as UTF-8 and looked up in the tables generated by
+ * scripts/gen-display-width.py.
+ */
+
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "display-width.h"
+
+struct CodepointRange {
+  uint32_t first;
+  uint32_t last;
+};
+#include "display-width-tables.h"
+
+
+/**
+ * Helper: The number of ASCII bytes at the start of str
+ */
+size_t __ascii_run(const char *str, size_t length) {
+  size_t i = 0;
+#ifdef __SSE2__
+  while (i + 16 <= length) {
+    int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (str + i)));
+    if (mask) return i + __builtin_ctz(mask);
+    i += 16;
+  }
+#endif
+  while (i + 8 <= length) {
+    uint64_t word;
+    memcpy(&word, str + i, sizeof(word));
+    if (word & 0x8080808080808080ULL) break;
+    i += 8;
+  }
+  while (i < length && !(str[i] & 0x80)) i++;
+  return i;
+}
+
+
+/**
+ * Helper: Decode the UTF-8 code point at the start of str (which
+ * doesn't start with an ASCII byte). An invalid sequence decodes as
+ * its first byte, as U+FFFD.
+ * @return the length of the code point in bytes
+ */
+size_t __utf8_decode(const unsigned char *str, size_t length, uint32_t *codepoint) {
+  size_t bytes;
+  uint32_t cp;
+  uint32_t min;
+
+  if      ((str[0] & 0xE0) == 0xC0) { bytes = 2; cp = str[0] & 0x1F; min = 0x80; }
+  else if ((str[0] & 0xF0) == 0xE0) { bytes = 3; cp = str[0] & 0x0F; min = 0x800; }
+  else if ((str[0] & 0xF8) == 0xF0) { bytes = 4; cp = str[0] & 0x07; min = 0x10000; }
+  else goto invalid;
+
+  if (bytes > length) goto invalid;
+  for (size_t i = 1; i < bytes; i++) {
+    if ((str[i] & 0xC0) != 0x80) goto invalid;
+    cp = (cp << 6) | (str[i] & 0x3F);
+  }
+  if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) goto invalid;
+
+  *codepoint = cp;
+  return bytes;
+
+ invalid:
+  *codepoint = 0xFFFD;
+  return 1;
+}
+
+
+/**
+ * Helper: check if the code point is in one of the (sorted) ranges
+ */
+int __in_ranges(uint32_t codepoint, const struct CodepointRange *ranges, size_t count) {
+  if (codepoint < ranges[0].first || codepoint > ranges[count - 1].last) return 0;
+
+  size_t low = 0;
+  size_t high = count;
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    if (codepoint > ranges[middle].last)       low = middle + 1;
+    else if (codepoint < ranges[middle].first) high = middle;
+    else return 1;
+  }
+  return 0;
+}
+
+
+/**
+ * The number of columns a code point takes up in a terminal.
+ */
+int codepoint_width(uint32_t codepoint) {
+  if (codepoint < 0x80) return 1;
+  if (codepoint < 0xA0) return 0; // C1 control characters
+  if (__in_ranges(codepoint, zero_width, sizeof(zero_width) / sizeof(zero_width[0]))) return 0;
+  if (__in_ranges(codepoint, double_width, sizeof(double_width) / sizeof(double_width[0]))) return 2;
+  return 1;
+}
+
+
+/**
+ * The number of columns the first length bytes of str take up.
+ */
+int display_width(const char *str, size_t length) {
+  int width = 0;
+  size_t i = 0;
+
+  while (i < length) {
+    size_t ascii = __ascii_run(str + i, length - i);
+    width += ascii;
+    i += ascii;
+    if (i < length) {
+      uint32_t codepoint;
+      i += __utf8_decode((const unsigned char *) str + i, length - i, &codepoint);
+      width += codepoint_width(codepoint);
+    }
+  }
+  return width;
+}
+
+
+/**
+ * The length in bytes of the longest beginning of str which fits in
+ * columns.
+ */
+size_t display_prefix(const char *str, size_t length, int columns) {
+  int width = 0;
+  size_t i = 0;
+
+  if (columns <= 0) return 0;
+
+  while (i < length) {
+    size_t ascii = __ascii_run(str + i, length - i);
+    if (width + (int) ascii > columns) return i + (columns - width);
+    width += ascii;
+    i += ascii;
+    if (i < length) {
+      uint32_t codepoint;
+      size_t bytes = __utf8_decode((const unsigned char *) str + i, length - i, &codepoint);
+      width += codepoint_width(codepoint);
+      if (width > columns) return i;
+      i += bytes;
+    }
+  }
+  return length;
+}
+
+
+/**
+ * The offset in bytes of the longest end of str which fits in
+ * columns.
+ */
+size_t display_suffix(const char *str, size_t length, int columns) {
+  int excess = display_width(str, length) - columns;
+  size_t i = 0;
+
+  // drop code points from the start until it fits ...
+  while (i < length && excess > 0) {
+    if (!(str[i] & 0x80)) {
+      excess--;
+      i++;
+    }
+    else {
+      uint32_t codepoint;
+      i += __utf8_decode((const unsigned char *) str + i, length - i, &codepoint);
+      excess -= codepoint_width(codepoint);
+    }
+  }
+  // ... and any combining marks left without their code point
+  while (i < length && (str[i] & 0x80)) {
+    uint32_t codepoint;
+    size_t bytes = __utf8_decode((const unsigned char *) str + i, length - i, &codepoint);
+    if (codepoint_width(codepoint) != 0) break;
+    i += bytes;
+  }
+  return i;
+}
@@ -0,0 +1,42 @@
+#ifndef DISPLAYWIDTH_H
+#define DISPLAYWIDTH_H
+/*
+  header file for display-width.c
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * The number of columns a code point takes up in a terminal: 0 for
+ * combining marks and other zero width characters, 2 for East Asian
+ * wide characters and emoji, 1 for everything else - as wcwidth()
+ * would have it, but without depending on the locale.
+ */
+int codepoint_width(uint32_t codepoint);
+
+
+/**
+ * The number of columns the first length bytes of str take up in a
+ * terminal. Bytes which aren't valid UTF-8 take up a column each.
+ */
+int display_width(const char *str, size_t length);
+
+
+/**
+ * The length in bytes of the longest beginning of str (of length
+ * bytes) which fits in the given number of columns. Code points, and
+ * the combining marks after them, are never split.
+ */
+size_t display_prefix(const char *str, size_t length, int columns);
+
+
+/**
+ * The offset in bytes of the longest end of str (of length bytes)
+ * which fits in the given number of columns. It never starts in the
+ * middle of a code point, or with a combining mark.
+ */
+size_t display_suffix(const char *str, size_t length, int columns);
+
+
+#endif //DISPLAYWIDTH_H
@@ -0,0 +1,360 @@
+/*
+ * emitters.c
+ *
+ * Writes rendered prompts for the shell, or other program, they are
+ * for.
+ *
+ * Prompts are rendered in bash's dialect: non-printing sequences are
+ * marked with `\[ \]`, the escape character is `\e` or `\033`, and
+ * the prompt escapes (`\u`, `\w`, ...) are left for the shell. An
+ * emitter describes how another target writes the same things, and
+ * emit_prompt() translates a prompt in one pass.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include "constants.h"
+#include "emitters.h"
+
+/**
+   Max number of parameters of an SGR sequence which are translated
+*/
+#define SGR_MAX_PARAMS 32
+
+
+/**
+   A growing string for emit_prompt() to write into
+*/
+struct EmitterOutput {
+  char   *text;
+  size_t  length;
+  size_t  size;
+  int     failed; // out of memory
+};
+
+/**
+   A backslash escape of bash, and what it becomes
+*/
+struct EmitterEscape {
+  char        bash;
+  const char *text;
+};
+
+/**
+   How prompts are written for a dialect
+*/
+struct PromptEmitter {
+  const char                 *name;    // as in [SYSTEM] shell
+  const struct EmitterEscape *escapes; // ends with { 0, NULL }; NULL = bash itself
+  char                        quote;   // doubled to show as-is, or 0
+  int                         expands; // 1 = \u, \h, \H, \w, \W and \$ are filled in
+  int                         final_newline; // 1 = keep the newline after the last line
+
+  // write an SGR sequence in the target's own syntax (or NULL to
+  // write it as it is)
+  void (*sgr)(struct EmitterOutput *output, const char *params, size_t length);
+};
+
+
+/**
+ * Helper: Append to the output
+ */
+void __emit(struct EmitterOutput *output, const char *bytes, size_t length) {
+  if (output->failed) return;
+  if (output->length + length + 1 > output->size) {
+    size_t size = (output->length + length + 1) * 2;
+    char *text = realloc(output->text, size);
+    if (!text) {
+      output->failed = 1;
+      return;
+    }
+    output->text = text;
+    output->size = size;
+  }
+  memcpy(output->text + output->length, bytes, length);
+  output->length += length;
+  output->text[output->length] = '\0';
+}
+
+/**
+ * Helper: Append a string to the output
+ */
+void __emit_string(struct EmitterOutput *output, const char *str) {
+  __emit(output, str, strlen(str));
+}
+
+
+/**
+ * Helper: Write an SGR sequence (its parameters, such as "1;38;5;208")
+ * as a tmux style, such as "#[bold,fg=colour208]". Parameters tmux
+ * has no style for are left out.
+ */
+void __sgr_to_tmux(struct EmitterOutput *output, const char *params, size_t length) {
+  static const char *colours[8] = {
+    "black", "red", "green", "yellow", "blue", "magenta", "cyan", "white",
+  };
+  static const struct { int code; const char *style; } styles[] = {
+    {  0, "default"         },
+    {  1, "bold"            },
+    {  2, "dim"             },
+    {  3, "italics"         },
+    {  4, "underscore"      },
+    {  5, "blink"           },
+    {  7, "reverse"         },
+    {  8, "hidden"          },
+    {  9, "strikethrough"   },
+    { 22, "nobold,nodim"    },
+    { 23, "noitalics"       },
+    { 24, "nounderscore"    },
+    { 25, "noblink"         },
+    { 27, "noreverse"       },
+    { 28, "nohidden"        },
+    { 29, "nostrikethrough" },
+    { 39, "fg=default"      },
+    { 49, "bg=default"      },
+  };
+
+  // "" is the same as "0"
+  int codes[SGR_MAX_PARAMS];
+  size_t count = 0;
+  int code = 0;
+  for (size_t i = 0; i <= length; i++) {
+    if (i == length || params[i] == ';' || params[i] == ':') {
+      if (count < SGR_MAX_PARAMS) codes[count++] = code;
+      code = 0;
+    }
+    else if (code < 1000) {
+      code = code * 10 + (params[i] - '0');
+    }
+  }
+
+  char tmux[256] = "#[";
+  size_t used = 2;
+  for (size_t i = 0; i < count; i++) {
+    int c = codes[i];
+    const char *layer = (c >= 40 && c < 50) || c >= 100 ? "bg" : "fg";
+    char style[32] = "";
+
+    if ((c == 38 || c == 48) && i + 2 < count && codes[i + 1] == 5) {
+      snprintf(style, sizeof(style), "%s=colour%d", layer, codes[i + 2]);
+      i += 2;
+    }
+    else if ((c == 38 || c == 48) && i + 4 < count && codes[i + 1] == 2) {
+      snprintf(style, sizeof(style), "%s=#%02x%02x%02x", layer,
+               codes[i + 2] & 0xff, codes[i + 3] & 0xff, codes[i + 4] & 0xff);
+      i += 4;
+    }
+    else if ((c >= 30 && c <= 37) || (c >= 40 && c <= 47)) {
+      snprintf(style, sizeof(style), "%s=%s", layer, colours[c % 10]);
+    }
+    else if ((c >= 90 && c <= 97) || (c >= 100 && c <= 107)) {
+      snprintf(style, sizeof(style), "%s=bright%s", layer, colours[c % 10]);
+    }
+    else {
+      for (size_t j = 0; j < sizeof(styles) / sizeof(styles[0]); j++) {
+        if (styles[j].code == c) {
+          snprintf(style, sizeof(style), "%s", styles[j].style);
+          break;
+        }
+      }
+    }
+
+    size_t style_length = strlen(style);
+    if (style_length > 0 && used + style_length + 2 < sizeof(tmux)) {
+      if (used > 2) tmux[used++] = ',';
+      memcpy(tmux + used, style, style_length);
+      used += style_length;
+    }
+  }
+
+  if (used > 2) {
+    tmux[used++] = ']';
+    __emit(output, tmux, used);
+  }
+}
+
+
+/**
+   The escapes of zsh
+*/
+static const struct EmitterEscape zsh_escapes[] = {
+  { '[',  "%{"   },
+  { ']',  "%}"   },
+  { 'e',  "\033" },
+  { 'E',  "\033" },
+  { 'a',  "\007" },
+  { 'u',  "%n"   },
+  { 'h',  "%m"   },
+  { 'H',  "%M"   },
+  { 'w',  "%~"   },
+  { 'W',  "%1~"  },
+  { '$',  "%#"   },
+  { 't',  "%*"   },
+  { 'n',  "\n"   },
+  { '\\', "\\"   },
+  { 0,    NULL   },
+};
+
+/**
+   The escapes of targets which take the escape sequences as they
+   are, and measure them themselves
+*/
+static const struct EmitterEscape raw_escapes[] = {
+  { '[',  ""     },
+  { ']',  ""     },
+  { 'e',  "\033" },
+  { 'E',  "\033" },
+  { 'a',  "\007" },
+  { 'n',  "\n"   },
+  { '\\', "\\"   },
+  { 0,    NULL   },
+};
+
+/**
+   The emitters, by shell_dialect
+*/
+static const struct PromptEmitter emitters[] = {
+  [SHELL_BASH] = { "bash", NULL,         0,   0, 1, NULL          },
+  [SHELL_ZSH]  = { "zsh",  zsh_escapes,  '%', 0, 1, NULL          },
+  [SHELL_FISH] = { "fish", raw_escapes,  0,   1, 0, NULL          },
+  [SHELL_TMUX] = { "tmux", raw_escapes,  '#', 1, 0, __sgr_to_tmux },
+  [SHELL_ANSI] = { "ansi", raw_escapes,  0,   1, 0, NULL          },
+};
+
+#define EMITTER_COUNT (sizeof(emitters) / sizeof(emitters[0]))
+
+
+/**
+ * Look up a shell dialect by name.
+ */
+int shell_dialect_lookup(const char *name, enum shell_dialect *shell) {
+  for (size_t i = 0; i < EMITTER_COUNT; i++) {
+    if (strcasecmp(name, emitters[i].name) == 0) {
+      *shell = (enum shell_dialect) i;
+      return SUCCESS;
+    }
+  }
+  return FAILURE;
+}
+
+
+/**
+ * Check if a dialect needs the PromptExpansions.
+ */
+int shell_dialect_expands(enum shell_dialect shell) {
+  return emitters[shell].expands;
+}
+
+
+/**
+ * Helper: The length of the escape character at str - `\e`, `\E`,
+ * `\033` or the character itself - or 0 if there isn't one
+ */
+size_t __escape_length(const char *str) {
+  if (str[0] == '\033') return 1;
+  if (str[0] != '\\') return 0;
+  if (str[1] == 'e' || str[1] == 'E') return 2;
+  if (strncmp(str, "\\033", 4) == 0) return 4;
+  return 0;
+}
+
+/**
+ * Helper: What a prompt escape of bash stands for, or NULL if it
+ * isn't one the emitter fills in
+ */
+const char *__expansion(const struct PromptEmitter *emitter,
+                        char escape,
+                        const struct PromptExpansions *expansions) {
+  if (!emitter->expands || !expansions) return NULL;
+
+  const char *expansion = NULL;
+  switch (escape) {
+  case 'u': expansion = expansions->username;                break;
+  case 'h':
+  case 'H': expansion = expansions->hostname;                break;
+  case 'w': expansion = expansions->cwd_home;                break;
+  case 'W': expansion = expansions->cwd_basename;            break;
+  case '$': expansion = expansions->is_root ? "#" : "$";     break;
+  }
+  return expansion;
+}
+
+
+/**
+ * Write a prompt rendered for bash in another dialect.
+ */
+char *emit_prompt(enum shell_dialect shell,
+                  const char *input,
+                  const struct PromptExpansions *expansions) {
+  const struct PromptEmitter *emitter = &emitters[shell];
+  if (emitter->escapes == NULL) return strdup(input);
+
+  struct EmitterOutput output = { NULL, 0, 0, 0 };
+  __emit(&output, "", 0);
+
+  while (*input) {
+    // an SGR sequence, for a target with a syntax of its own for them
+    size_t escape_length = __escape_length(input);
+    if (emitter->sgr && escape_length > 0 && input[escape_length] == '[') {
+      const char *params = input + escape_length + 1;
+      size_t params_length = strspn(params, "0123456789;:");
+      if (params[params_length] == 'm') {
+        emitter->sgr(&output, params, params_length);
+        input = params + params_length + 1;
+        continue;
+      }
+    }
+
+    if (emitter->quote && *input == emitter->quote) {
+      __emit(&output, input, 1);
+      __emit(&output, input++, 1);
+      continue;
+    }
+    if (*input != '\\') {
+      __emit(&output, input++, 1);
+      continue;
+    }
+
+    // octal escapes: \033 and \007
+    if (strncmp(input, "\\033", 4) == 0 || strncmp(input, "\\007", 4) == 0) {
+      char character = (char) strtol(input + 1, NULL, 8);
+      __emit(&output, &character, 1);
+      input += 4;
+      continue;
+    }
+
+    const char *replacement = __expansion(emitter, input[1], expansions);
+    for (size_t i = 0; !replacement && emitter->escapes[i].text; i++) {
+      if (input[1] == emitter->escapes[i].bash) {
+        replacement = emitter->escapes[i].text;
+      }
+    }
+    if (replacement) {
+      __emit_string(&output, replacement);
+      input += 2;
+    }
+    else {
+      __emit(&output, input++, 1); // not ours to translate
+    }
+  }
+
+  if (output.failed) {
+    free(output.text);
+    return NULL;
+  }
+  if (!emitter->final_newline && output.length > 0 && output.text[output.length - 1] == '\n') {
+    output.text[--output.length] = '\0';
+  }
+  return output.text;
+}
+
+
+/**
+ * Translates a rendered bash prompt into a zsh prompt.
+ */
+char *bash_to_zsh_prompt(const char *input) {
+  return emit_prompt(SHELL_ZSH, input, NULL);
+}
@@ -0,0 +1,88 @@
+#ifndef EMITTERS_H
+#define EMITTERS_H
+/*
+  header file for emitters.c
+*/
+
+
+/**
+ * The shells, and other programs, prompt2 can write prompts for.
+ * They differ in how non-printing sequences (such as colours) are
+ * marked, and in which characters have a meaning of their own.
+ */
+enum shell_dialect {
+  SHELL_BASH = 0, // \[ ... \]
+  SHELL_ZSH  = 1, // %{ ... %}
+  SHELL_FISH = 2, // raw escape sequences, fish measures them itself
+  SHELL_TMUX = 3, // #[...] styles, for status-left and status-right
+  SHELL_ANSI = 4, // raw escape sequences, for anything else
+};
+
+
+/**
+ * What the prompt escapes of bash (\u, \h, \w, ...) stand for, for
+ * the targets which don't have them.
+ */
+struct PromptExpansions {
+  const char *username;
+  const char *hostname;
+  const char *cwd_home;     // \w: the working directory, with ~ for HOME
+  const char *cwd_basename; // \W
+  int         is_root;      // \$ is # if set, $ otherwise
+};
+
+
+/**
+ * Look up a shell dialect by name, as in `[SYSTEM] shell = fish`.
+ * Names are case-insensitive.
+ *
+ * @param shell  Set to the dialect, if the name is known.
+ * @return SUCCESS, or FAILURE if the name isn't known
+ */
+int shell_dialect_lookup(const char *name, enum shell_dialect *shell);
+
+
+/**
+ * Check if a dialect needs the PromptExpansions to write a prompt.
+ * @return 1 if it does, 0 if not
+ */
+int shell_dialect_expands(enum shell_dialect shell);
+
+
+/**
+ * Write a prompt rendered for bash in another dialect:
+ * - `\[` and `\]` become the target's markers around non-printing
+ *   sequences, if it has any
+ * - `\e`, `\033`, `\a` and `\007` become the characters they stand
+ *   for (or, for tmux, SGR sequences become `#[...]` styles)
+ * - the common bash prompt escapes (`\u`, `\h`, `\w`, `\W`, ...)
+ *   become the target's own, or what they stand for
+ * - characters the target gives a meaning (`%` for zsh, `#` for
+ *   tmux) are escaped
+ * Other backslash escapes are left as they are.
+ *
+ * @param input       A prompt rendered for bash.
+ * @param expansions  For dialects which expand the prompt escapes;
+ *                    may be NULL for the others.
+ * @return The prompt in the dialect, or NULL if out of memory. The
+ *         caller is responsible for freeing it.
+ */
+char *emit_prompt(enum shell_dialect shell,
+                  const char *input,
+                  const struct PromptExpansions *expansions);
+
+
+/**
+ * Translates a prompt rendered for bash into one for zsh: bash's
+ * `\[ \]` markers around non-printing sequences become `%{ %}`,
+ * backslash escapes become the characters they stand for, and `%` is
+ * escaped.
+ *
+ * @param input A prompt rendered for bash.
+ * @return      The same prompt for zsh. The caller is responsible for
+ *              freeing this string.
+ */
+char *bash_to_zsh_prompt(const char *input);
+
+
+#endif //EMITTERS_H
@@ -6,6 +6,8 @@
 #include <string.h>
 
 #include "attributes.h"
+#include "colour-index.h"
+#include "constants.h"
 #include "prompt2-utils.h"
 #include "term-attributes.h"
 
@@ -23,12 +25,65 @@ void usage() {
   printf(" --list-col-24bit    Instructions to create full RGB colors.\n");
   printf(" --list-col-names    List all available color names.\n");
   printf(" --list-reset        List all reset escape sequences.\n");
+  printf(" --nearest <colour>  The names of the nearest named colour to a colour:\n");
+  printf("                     '#rrggbb', 'r,g,b', '38;2;r;g;b' or '38;5;n' (48 for\n");
+  printf("                     the background). For the SGR code of an attribute,\n");
+  printf("                     such as '34', the attributes with that code.\n");
+  printf(" --batch [-0]        Read attributes from stdin, one per line (or ended\n");
+  printf("                     by NULs with -0), and write their escape codes the\n");
+  printf("                     same way.\n");
+  printf(" --nearest --batch [-0]\n");
+  printf("                     Likewise, the names of each colour read from stdin.\n");
   printf(" --usage, --help, -h Show this usage information.\n");
   printf("\n");
   printf("Example: to get the terminal escape code '\\[\\e[1;34;47m\\]', run:\n");
   printf(" get-attribute 'bold;fg blue;bg white'\n");
 }
 
+/**
+ * The escape code of an attribute combo
+ */
+const char *lookup_combo(dictionary *attribute_dict, const char *combo) {
+  return get_attribute_combo(attribute_dict, combo);
+}
+
+/**
+ * The names of the nearest named colour, or of the attributes with
+ * an SGR code
+ */
+const char *lookup_colour(dictionary *attribute_dict, const char *colour) {
+  (void) attribute_dict;
+  char names[1024];
+  return strdup(colour_names(colour, names, sizeof(names)) == SUCCESS ? names : "UNKNOWN_COLOUR");
+}
+
+/**
+ * Look up what's read from stdin, each ended by the delimiter, and
+ * write what's found the same way, one for each. The attribute
+ * dictionary is only created once, for all of them.
+ */
+int batch(char delimiter, const char *(*lookup)(dictionary *, const char *)) {
+  dictionary *attribute_dict = create_attribute_dict();
+  char *query = NULL;
+  size_t size = 0;
+  ssize_t length;
+
+  while ((length = getdelim(&query, &size, delimiter, stdin)) != -1) {
+    if (length > 0 && query[length - 1] == delimiter) {
+      query[length - 1] = '\0';
+    }
+    const char *result = lookup(attribute_dict, query);
+    fputs(result ? result : "", stdout);
+    fputc(delimiter, stdout);
+    free((void *) result);
+  }
+
+  free(query);
+  free_attribute_dict(attribute_dict);
+  free_colour_index();
+  return 0;
+}
+
 int main(int argc, char *argv[]) {
   if (argc < 2) {
     usage();
@@ -80,6 +135,22 @@ int main(int argc, char *argv[]) {
     
     exit_status = 0;
   }
+  else if (strcmp(category, "--batch") == 0) {
+    int nul_separated = argc > 2 && strcmp(argv[2], "-0") == 0;
+    exit_status = batch(nul_separated ? '\0' : '\n', lookup_combo);
+  }
+  else if (strcmp(category, "--nearest") == 0 && argc > 2 && strcmp(argv[2], "--batch") == 0) {
+    int nul_separated = argc > 3 && strcmp(argv[3], "-0") == 0;
+    exit_status = batch(nul_separated ? '\0' : '\n', lookup_colour);
+  }
+  else if (strcmp(category, "--nearest") == 0 && argc > 2) {
+    char names[1024];
+    if (colour_names(argv[2], names, sizeof(names)) == SUCCESS) {
+      printf("%s\n", names);
+      exit_status = 0;
+    }
+    free_colour_index();
+  }
   else if (strcmp(category, "--usage") == 0 ||
            strcmp(category, "--help")  == 0 ||
            strcmp(category, "-h") == 0) {
@@ -4,11 +4,14 @@
 #define _GNU_SOURCE
 #endif
 
+#include <ctype.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <git2.h>
 #include <json-c/json.h>
 #include <libgen.h>
 #include <limits.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -17,9 +20,6 @@
 #include <linux/limits.h> // For PATH_MAX
 #elif __APPLE__
 #include <sys/syslimits.h> // For PATH_MAX
-// HOST_NAME_MAX is not defined on macOS
-// use _POSIX_HOST_NAME_MAX from limit.h instead
-#define HOST_NAME_MAX _POSIX_HOST_NAME_MAX
 #else
 #error "Unknown or unsupported OS"
 #endif
@@ -32,39 +32,275 @@
 /* Helper functions                                   */
 /* ================================================== */
 
+/**
+   What each of the dir_markers is called, and the type of project it
+   makes a directory
+*/
+static const struct {
+  const char *name;
+  const char *type; // of the project, NULL for a version file
+  int         is_dir;
+} dir_markers[MARKER_COUNT] = {
+  [MARKER_PACKAGE_JSON]   = { "package.json",    "node",      0 },
+  [MARKER_CARGO_TOML]     = { "Cargo.toml",      "rust",      0 },
+  [MARKER_GO_MOD]         = { "go.mod",          "go",        0 },
+  [MARKER_PYPROJECT_TOML] = { "pyproject.toml",  "python",    0 },
+  [MARKER_TERRAFORM]      = { ".terraform",      "terraform", 1 },
+  [MARKER_TOOL_VERSIONS]  = { ".tool-versions",  "asdf",      0 },
+  [MARKER_PYTHON_VERSION] = { ".python-version", NULL,        0 },
+  [MARKER_NVMRC]          = { ".nvmrc",          NULL,        0 },
+  [MARKER_NODE_VERSION]   = { ".node-version",   NULL,        0 },
+};
+#define MARKER_BIT(marker)  (1u << (marker))
+#define MARKERS_PROJECT     (MARKER_BIT(MARKER_PYTHON_VERSION) - 1)
+
+/**
+   The markers found in a directory, by its inode. A directory's mtime
+   changes whenever an entry is added, removed or renamed in it, so
+   the markers are only looked for again then. This lives as long as
+   the process, so it only saves work for prompt2 --serve and the zsh
+   module; a one-shot prompt2 looks in each directory once anyway.
+*/
+#define MARKER_CACHE_SIZE 256 // a power of two
+struct MarkerCacheEntry {
+  dev_t           dev;
+  ino_t           ino;
+  struct timespec mtime;
+  unsigned        markers; // a bit for each of dir_markers
+  int             is_set;
+};
+static struct MarkerCacheEntry marker_cache[MARKER_CACHE_SIZE];
 
 /**
- * Checks if the given path is a git repository
- * @return 0 if true, 1 if false
+ * Helper: The markers in a directory, from the marker cache if it
+ * hasn't changed since they were looked for
+ * @return a bit for each of dir_markers found
  */
-int __is_git_repo(const char *path) {
-  int is_repo = FAILURE_IS_NOT_GIT_REPO;
-  git_repository *repo = NULL;
-  int error = git_repository_open_ext(&repo, path, 0, NULL);
-  if (error == 0) {
-    is_repo = SUCCESS_IS_GIT_REPO;
-    git_repository_free(repo);
+unsigned __markers_in(const char *dir) {
+  struct stat st;
+  if (stat(dir, &st) != 0) return 0;
+
+  size_t slot = ((size_t) st.st_ino * 2654435761u ^ (size_t) st.st_dev) & (MARKER_CACHE_SIZE - 1);
+  struct MarkerCacheEntry *entry = &marker_cache[slot];
+  if (entry->is_set && entry->dev == st.st_dev && entry->ino == st.st_ino &&
+      entry->mtime.tv_sec == STAT_MTIME(&st).tv_sec &&
+      entry->mtime.tv_nsec == STAT_MTIME(&st).tv_nsec) {
+    return entry->markers;
+  }
+
+  unsigned markers = 0;
+  int dir_fd = open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (dir_fd >= 0) {
+    for (size_t i = 0; i < MARKER_COUNT; i++) {
+      struct stat marker;
+      if (fstatat(dir_fd, dir_markers[i].name, &marker, 0) == 0 &&
+          !S_ISDIR(marker.st_mode) == !dir_markers[i].is_dir) {
+        markers |= MARKER_BIT(i);
+      }
+    }
+    close(dir_fd);
   }
-  return is_repo;
+
+  entry->dev     = st.st_dev;
+  entry->ino     = st.st_ino;
+  entry->mtime   = STAT_MTIME(&st);
+  entry->markers = markers;
+  entry->is_set  = 1;
+  return markers;
+}
+
+
+/* ================================================== */
+/* Reading the .git directory without libgit2         */
+/* ================================================== */
+
+/*
+  Finding the repository, the branch name and the HEAD commit only
+  needs a handful of small files in the .git directory. Reading them
+  directly lets prompts which don't show any status widgets skip
+  libgit2 - its initialisation, opening the repository and resolving
+  references - altogether.
+*/
+
+#define OID_RAW_SIZE      20 // SHA-1
+#define MAX_SYMREF_DEPTH  5
+
+/**
+ * Helper: Read the first line of a file, without the line ending
+ * @return SUCCESS or FAILURE
+ */
+int __read_first_line(const char *path, char *buf, size_t size) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return FAILURE;
+
+  ssize_t len = read(fd, buf, size - 1);
+  close(fd);
+  if (len <= 0) return FAILURE;
+
+  buf[len] = '\0';
+  buf[strcspn(buf, "\r\n")] = '\0';
+  return SUCCESS;
+}
+
+/**
+ * Helper: Turn a path from a git file into an absolute path. Relative
+ * paths are relative to base.
+ */
+void __resolve_git_path(char *out, size_t size, const char *base, const char *path) {
+  if (path[0] == '/') snprintf(out, size, "%s", path);
+  else                snprintf(out, size, "%s/%s", base, path);
+}
+
+/**
+ * Helper: Go up one level from a directory, in place
+ * @return SUCCESS, or FAILURE at the root
+ */
+int __parent_dir(char *path) {
+  char *last_slash = strrchr(path, '/');
+  if (last_slash == NULL || strcmp(path, "/") == 0) return FAILURE;
+  if (last_slash == path) last_slash++; // keep the root
+  *last_slash = '\0';
+  return SUCCESS;
 }
 
 /**
- * Given a path, returns root of git repo or empty string
+ * Helper: Find the repository containing path by walking upwards,
+ * as git does. At each level, look for a `.git` directory, or for a
+ * `.git` file with a `gitdir:` line, as used by worktrees and
+ * submodules.
+ *
+ * @param work_tree set to the root of the working tree
+ * @param git_dir   set to the git directory
+ * @param marker_dir_length if not NULL, set to the length of the
+ *                  nearest directory on the way with each of the
+ *                  dir_markers, or left as it is if none has it
+ * @return SUCCESS_IS_GIT_REPO or FAILURE_IS_NOT_GIT_REPO
  */
-const char *__find_git_repository_path(const char *path) {
-  git_buf repo_path = { 0 };
-  int error = git_repository_discover(&repo_path, path, 0, NULL);
+int __find_git_dir(const char *path, char *work_tree, char *git_dir, size_t *marker_dir_length) {
+  snprintf(work_tree, PATH_MAX, "%s", path);
+
+  while (1) {
+    if (marker_dir_length) {
+      unsigned markers = __markers_in(work_tree);
+      for (size_t i = 0; i < MARKER_COUNT; i++) {
+        if ((markers & MARKER_BIT(i)) && marker_dir_length[i] == 0) marker_dir_length[i] = strlen(work_tree);
+      }
+    }
+    snprintf(git_dir, PATH_MAX, "%s/.git", strcmp(work_tree, "/") == 0 ? "" : work_tree);
+
+    struct stat st;
+    if (stat(git_dir, &st) == 0) {
+      if (S_ISDIR(st.st_mode)) return SUCCESS_IS_GIT_REPO;
+
+      char line[PATH_MAX];
+      if (S_ISREG(st.st_mode) &&
+          __read_first_line(git_dir, line, sizeof(line)) == SUCCESS &&
+          strncmp(line, "gitdir: ", 8) == 0) {
+        __resolve_git_path(git_dir, PATH_MAX, work_tree, line + 8);
+        return SUCCESS_IS_GIT_REPO;
+      }
+    }
 
-  if (error == 0) {
-    char *last_slash = strstr(repo_path.ptr, "/.git/");
-    if (last_slash) *last_slash = '\0';
+    if (__parent_dir(work_tree) != SUCCESS) break;
+  }
 
-    char *result = strdup(repo_path.ptr);
-    git_buf_free(&repo_path);
-    return result;
+  work_tree[0] = '\0';
+  git_dir[0] = '\0';
+  return FAILURE_IS_NOT_GIT_REPO;
+}
+
+/**
+ * Helper: Find the directory holding the refs shared by all
+ * worktrees. For a plain repository, this is the git directory.
+ */
+void __find_common_dir(const char *git_dir, char *common_dir) {
+  char path[PATH_MAX];
+  char line[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/commondir", git_dir);
+  if (__read_first_line(path, line, sizeof(line)) == SUCCESS) {
+    __resolve_git_path(common_dir, PATH_MAX, git_dir, line);
   }
+  else {
+    snprintf(common_dir, PATH_MAX, "%s", git_dir);
+  }
+}
 
-  return strdup("");
+/**
+ * Helper: Parse a hexadecimal object id
+ * @return SUCCESS or FAILURE
+ */
+int __parse_oid(const char *hex, git_oid *oid) {
+  memset(oid, 0, sizeof(*oid));
+  for (int i = 0; i < OID_RAW_SIZE * 2; i++) {
+    char c = hex[i];
+    int nibble;
+    if      (c >= '0' && c <= '9') nibble = c - '0';
+    else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+    else return FAILURE;
+    oid->id[i / 2] |= (unsigned char) (i % 2 ? nibble : nibble << 4);
+  }
+  return SUCCESS;
+}
+
+/**
+ * Helper: Look a ref up in packed-refs
+ * @return SUCCESS or FAILURE
+ */
+int __resolve_packed_ref(const char *common_dir, const char *ref, git_oid *oid) {
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/packed-refs", common_dir);
+  FILE *fp = fopen(path, "r");
+  if (!fp) return FAILURE;
+
+  // Lines look like "<hex id> <ref name>". Comments start with '#'
+  // and peeled tags with '^'.
+  int result = FAILURE;
+  size_t ref_len = strlen(ref);
+  char *line = NULL;
+  size_t len = 0;
+  ssize_t read;
+  while ((read = getline(&line, &len, fp)) != -1) {
+    if (line[0] == '#' || line[0] == '^') continue;
+    if (read < OID_RAW_SIZE * 2 + 1 || line[OID_RAW_SIZE * 2] != ' ') continue;
+
+    const char *name = line + OID_RAW_SIZE * 2 + 1;
+    if (strncmp(name, ref, ref_len) == 0 &&
+        (name[ref_len] == '\n' || name[ref_len] == '\r' || name[ref_len] == '\0')) {
+      result = __parse_oid(line, oid);
+      break;
+    }
+  }
+  free(line);
+  fclose(fp);
+  return result;
+}
+
+/**
+ * Helper: Resolve a ref to an object id. Loose refs are looked up in
+ * the git directory (for per-worktree refs) and the common directory,
+ * then packed-refs. Symbolic refs are followed.
+ *
+ * @return SUCCESS or FAILURE, e.g. if the branch has no commits yet
+ */
+int __resolve_ref(const char *git_dir, const char *common_dir, const char *ref, git_oid *oid, int depth) {
+  if (depth > MAX_SYMREF_DEPTH) return FAILURE;
+
+  char path[PATH_MAX];
+  char line[PATH_MAX];
+  const char *dirs[] = { git_dir, common_dir };
+  for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+    if (i > 0 && strcmp(dirs[i], dirs[0]) == 0) break;
+
+    snprintf(path, sizeof(path), "%s/%s", dirs[i], ref);
+    if (__read_first_line(path, line, sizeof(line)) != SUCCESS) continue;
+
+    if (strncmp(line, "ref: ", 5) == 0) {
+      return __resolve_ref(git_dir, common_dir, line + 5, oid, depth + 1);
+    }
+    return __parse_oid(line, oid);
+  }
+  return __resolve_packed_ref(common_dir, ref, oid);
 }
 
 
@@ -111,100 +347,664 @@ int __calculate_divergence(git_repository *repo,
 }
 
 /**
- * Helper: Determine if a Git repository is currently in an
- * interactive rebase state
+ * Things in the git directory which tell what the repo is in the
+ * middle of. Mirrors git_repository_state().
  */
-void __check_for_interactive_rebase(struct CurrentState *state) {
-  char rebase_merge_path[PATH_MAX];
-  char rebase_apply_path[PATH_MAX];
-  snprintf(rebase_merge_path, sizeof(rebase_merge_path), "%s/.git/rebase-merge", state->repo_path);
-  snprintf(rebase_apply_path, sizeof(rebase_apply_path), "%s/.git/rebase-apply", state->repo_path);
+enum repo_state_markers {
+  MARKER_REBASE_MERGE     = 1 << 0, // rebase-merge/
+  MARKER_REBASE_APPLY     = 1 << 1, // rebase-apply/
+  MARKER_MERGE_HEAD       = 1 << 2,
+  MARKER_REVERT_HEAD      = 1 << 3,
+  MARKER_CHERRY_PICK_HEAD = 1 << 4,
+  MARKER_BISECT_LOG       = 1 << 5,
+};
 
-  struct stat merge_stat, apply_stat;
-  state->is_rebase_in_progress = 0;
-  if (stat(rebase_merge_path, &merge_stat) == 0 || stat(rebase_apply_path, &apply_stat) == 0) {
+/**
+ * Helper: Read the first line of a file relative to a directory
+ * @return SUCCESS or FAILURE
+ */
+int __read_first_line_at(int dir_fd, const char *path, char *buf, size_t size) {
+  int fd = openat(dir_fd, path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return FAILURE;
+
+  ssize_t len = read(fd, buf, size - 1);
+  close(fd);
+  if (len <= 0) return FAILURE;
+
+  buf[len] = '\0';
+  buf[strcspn(buf, "\r\n")] = '\0';
+  return SUCCESS;
+}
+
+/**
+ * Helper: Set rebase_step to "<done>/<total>" from two files in the
+ * rebase directory
+ */
+void __read_rebase_step(struct CurrentState *state, int dir_fd, const char *done_path, const char *total_path) {
+  char done[16];
+  char total[16];
+  if (__read_first_line_at(dir_fd, done_path, done, sizeof(done)) == SUCCESS &&
+      __read_first_line_at(dir_fd, total_path, total, sizeof(total)) == SUCCESS) {
+    snprintf(state->rebase_step, sizeof(state->rebase_step), "%d/%d", atoi(done), atoi(total));
+  }
+}
+
+/**
+ * Helper: Find out if the repo is in the middle of a rebase, merge,
+ * cherry-pick, revert or bisect, from a single scan of the git
+ * directory. The files inside a rebase directory are only read when
+ * there is one.
+ */
+void __probe_repo_state(struct CurrentState *state) {
+  state->is_rebase_in_progress      = 0;
+  state->is_merge_in_progress       = 0;
+  state->is_cherry_pick_in_progress = 0;
+  state->is_revert_in_progress      = 0;
+  state->is_bisect_in_progress      = 0;
+  state->rebase_step[0]             = '\0';
+  state->repo_state                 = "";
+
+  int dir_fd = open(state->git_dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (dir_fd < 0) return;
+  DIR *dir = fdopendir(dir_fd);
+  if (dir == NULL) {
+    close(dir_fd);
+    return;
+  }
+
+  static const struct { const char *name; int marker; } markers[] = {
+    { "rebase-merge",     MARKER_REBASE_MERGE     },
+    { "rebase-apply",     MARKER_REBASE_APPLY     },
+    { "MERGE_HEAD",       MARKER_MERGE_HEAD       },
+    { "REVERT_HEAD",      MARKER_REVERT_HEAD      },
+    { "CHERRY_PICK_HEAD", MARKER_CHERRY_PICK_HEAD },
+    { "BISECT_LOG",       MARKER_BISECT_LOG       },
+  };
+
+  int found = 0;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    // all markers start with an upper case letter or 'r'
+    char first = entry->d_name[0];
+    if (first != 'r' && (first < 'A' || first > 'Z')) continue;
+
+    for (size_t i = 0; i < sizeof(markers) / sizeof(markers[0]); i++) {
+      if (strcmp(entry->d_name, markers[i].name) == 0) {
+        found |= markers[i].marker;
+        break;
+      }
+    }
+  }
+
+  // In the same order of precedence as git_repository_state()
+  if (found & MARKER_REBASE_MERGE) {
+    state->is_rebase_in_progress = 1;
+    state->repo_state = faccessat(dir_fd, "rebase-merge/interactive", F_OK, 0) == 0 ? "REBASE-i" : "REBASE-m";
+    __read_rebase_step(state, dir_fd, "rebase-merge/msgnum", "rebase-merge/end");
+  }
+  else if (found & MARKER_REBASE_APPLY) {
     state->is_rebase_in_progress = 1;
+    if      (faccessat(dir_fd, "rebase-apply/rebasing", F_OK, 0) == 0) state->repo_state = "REBASE";
+    else if (faccessat(dir_fd, "rebase-apply/applying", F_OK, 0) == 0) state->repo_state = "AM";
+    else                                                               state->repo_state = "AM/REBASE";
+    __read_rebase_step(state, dir_fd, "rebase-apply/next", "rebase-apply/last");
+  }
+  else if (found & MARKER_MERGE_HEAD) {
+    state->repo_state = "MERGING";
+  }
+  else if (found & MARKER_REVERT_HEAD) {
+    state->repo_state = "REVERTING";
+  }
+  else if (found & MARKER_CHERRY_PICK_HEAD) {
+    state->repo_state = "CHERRY-PICKING";
+  }
+  else if (found & MARKER_BISECT_LOG) {
+    state->repo_state = "BISECTING";
   }
+
+  // A conflicted cherry-pick can happen during a rebase, so these
+  // aren't mutually exclusive
+  state->is_merge_in_progress       = (found & MARKER_MERGE_HEAD)       != 0;
+  state->is_revert_in_progress      = (found & MARKER_REVERT_HEAD)      != 0;
+  state->is_cherry_pick_in_progress = (found & MARKER_CHERRY_PICK_HEAD) != 0;
+  state->is_bisect_in_progress      = (found & MARKER_BISECT_LOG)       != 0;
+
+  closedir(dir); // closes dir_fd too
 }
 
 /**
- * Helper: set RepoContext with repo name and return it
+ * Helper: Open the repository with libgit2, for the widgets that need
+ * more than the HEAD context
  */
-const char * __get_repo_name(struct CurrentState *state) {
-  if (state->head_ref == NULL) {
-    state->repo_name = "NO_DATA";
-  } else {
-    state->repo_name = strrchr(state->repo_path, '/') + 1;
+int __populate_repo_context(struct CurrentState *state) {
+  git_repository *repo = NULL;
+  if (git_repository_open(&repo, state->repo_path) != 0) {
+    return FAILURE;
   }
-  return state->repo_name;
+
+  state->repo_obj = repo;
+  return SUCCESS;
 }
 
+/* ================================================== */
+/* Parallel working tree status                       */
+/* ================================================== */
+
+/*
+  An alternative to letting git_status_list_new() walk the working
+  tree. libgit2 stats the tracked files one at a time, so on a large
+  repo on fast storage the walk is bound by syscall latency rather
+  than CPU. Here the index is split up by top-level directory, and a
+  pool of threads compares stat data against the index entries and
+  looks for untracked files. Idle threads claim the next unprocessed
+  directory, largest first, so one huge directory doesn't leave the
+  others waiting.
+
+  Comparing HEAD with the index (staged files) doesn't touch the
+  working tree, so that part is still left to libgit2.
+*/
+
 /**
- * Helper: set RepoContext with repo branch and return it
+ * One unit of work: a top-level directory, or the files in the root
+ * of the working tree.
  */
-const char * __get_branch_name(struct CurrentState *state) {
-  if (state->head_ref == NULL) {
-    state->branch_name = "NO_DATA";
-  } else {
-    state->branch_name = git_reference_shorthand(state->head_ref);
+struct StatusWorkItem {
+  char                   *name;    // NULL for the root of the working tree
+  const git_index_entry **entries; // tracked entries below name
+  size_t                  count;
+};
+
+/**
+ * Everything shared between the workers. Read-only once the workers
+ * have been started, except for next_item.
+ */
+struct StatusWorkQueue {
+  int                     root_fd;      // the working tree
+  struct timespec         index_mtime;  // to spot racily clean entries
+  int                     filemode;     // core.filemode: is the executable bit tracked?
+  int                     trustctime;   // core.trustctime: is a changed ctime a change?
+  const git_index_entry **entries;      // all index entries, sorted by path
+  size_t                  entry_count;
+  struct StatusWorkItem  *items;
+  size_t                  item_count;
+  size_t                  next_item;    // claimed with an atomic fetch-and-add
+};
+
+/**
+ * Per-thread state. libgit2 objects must not be shared between
+ * threads, so each worker opens its own repository handle.
+ */
+struct StatusWorker {
+  pthread_t               thread;
+  struct StatusWorkQueue *queue;
+  git_repository         *repo;
+  char                    path[PATH_MAX]; // path relative to the working tree
+  int                     modified;
+  int                     untracked;
+};
+
+
+/**
+ * Helper: Index of the first index entry with a path >= key
+ */
+size_t __index_lower_bound(const struct StatusWorkQueue *queue, const char *key) {
+  size_t lo = 0;
+  size_t hi = queue->entry_count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (strcmp(queue->entries[mid]->path, key) < 0) lo = mid + 1;
+    else hi = mid;
   }
-  return state->branch_name;
+  return lo;
 }
 
 /**
- * Helper: Prep RepoContext with git repo info
+ * Helper: Is path tracked (a file, symlink or submodule)? A directory
+ * only counts if it is a submodule - one which replaced a tracked file
+ * is untracked, as in git.
  */
-int __populate_repo_context(struct CurrentState *state, const char *path) {
-  int result = FAILURE; // Default to failure
+int __index_has_path(const struct StatusWorkQueue *queue, const char *path, int is_dir) {
+  size_t i = __index_lower_bound(queue, path);
+  return i < queue->entry_count && strcmp(queue->entries[i]->path, path) == 0 &&
+    (!is_dir || (queue->entries[i]->mode & S_IFMT) == 0160000);
+}
 
-  const char *git_repository_path = NULL;
-  git_repository *repo = NULL;
-  git_reference *head_ref = NULL;
-  const git_oid *head_oid = NULL;
+/**
+ * Helper: Is anything tracked below the directory in path[0..len)?
+ */
+int __index_has_dir(const struct StatusWorkQueue *queue, char *path, size_t len) {
+  path[len] = '/';
+  path[len + 1] = '\0';
+  size_t i = __index_lower_bound(queue, path);
+  int found = i < queue->entry_count && strncmp(queue->entries[i]->path, path, len + 1) == 0;
+  path[len] = '\0';
+  return found;
+}
+
+/**
+ * Helper: Append a path component to path[0..len)
+ * @return the new length, or 0 if it doesn't fit
+ */
+size_t __path_push(char *path, size_t len, const char *name) {
+  size_t name_len = strlen(name);
+  if (len + name_len + 2 >= PATH_MAX) return 0; // room for '/' and a trailing '/'
+  if (len > 0) path[len++] = '/';
+  memcpy(path + len, name, name_len + 1);
+  return len + name_len;
+}
+
+/**
+ * Helper: Is the directory entry a directory? Falls back to lstat if
+ * the filesystem doesn't fill in d_type.
+ */
+int __is_dir(const struct StatusWorkQueue *queue, const struct dirent *entry, const char *path) {
+  if (entry->d_type != DT_UNKNOWN) return entry->d_type == DT_DIR;
 
-  if (state->repo_path == NULL) {
-    git_repository_path = __find_git_repository_path(path);
-    if (strlen(git_repository_path) == 0) {
-      goto cleanup; // Path not found, cleanup and exit
+  struct stat st;
+  return fstatat(queue->root_fd, path, &st, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(st.st_mode);
+}
+
+/**
+ * Helper: Open a directory relative to the working tree
+ */
+DIR *__open_workdir_dir(const struct StatusWorkQueue *queue, const char *path) {
+  int fd = openat(queue->root_fd, path, O_RDONLY | O_DIRECTORY);
+  if (fd < 0) return NULL;
+
+  DIR *dir = fdopendir(fd);
+  if (!dir) close(fd);
+  return dir;
+}
+
+/**
+ * Helper: Is path[0..len) ignored by .gitignore and friends?
+ */
+int __is_ignored(git_repository *repo, char *path, size_t len, int is_dir) {
+  int ignored = 0;
+  if (is_dir) {
+    path[len] = '/';
+    path[len + 1] = '\0';
+  }
+  git_ignore_path_is_ignored(&ignored, repo, path);
+  path[len] = '\0';
+  return ignored;
+}
+
+/**
+ * Helper: Decide if a tracked file differs from its index entry.
+ *
+ * Same rules as git: if the type, mode (when core.filemode is set) or
+ * size differ, the file is modified. If the stat data - size, mtime,
+ * ctime (when core.trustctime is set) and inode - matches the
+ * index, the file is clean - unless it was written in the same instant
+ * as the index (racy git), in which case the stat data can't be trusted
+ * and the content is hashed. Any other difference is settled by
+ * hashing too.
+ */
+int __entry_is_modified(struct StatusWorker *worker, const git_index_entry *entry) {
+  const struct StatusWorkQueue *queue = worker->queue;
+
+  // --assume-unchanged and --skip-worktree entries are taken as clean
+  if (entry->flags & GIT_INDEX_ENTRY_VALID) return 0;
+  if (entry->flags_extended & GIT_INDEX_ENTRY_SKIP_WORKTREE) return 0;
+
+  if ((entry->mode & S_IFMT) == 0160000) {
+    // a submodule is dirty if its checkout or its own working tree is
+    unsigned int status = 0;
+    if (git_submodule_status(&status, worker->repo, entry->path, GIT_SUBMODULE_IGNORE_UNSPECIFIED) != 0) {
+      return 0;
     }
-  } else {
-    git_repository_path = state->repo_path;
+    return !GIT_SUBMODULE_STATUS_IS_WD_UNMODIFIED(status);
   }
 
-  if (git_repository_open(&repo, git_repository_path) != 0) {
-    goto cleanup; // Failed to open repository, cleanup and exit
+  struct stat st;
+  if (fstatat(queue->root_fd, entry->path, &st, AT_SYMLINK_NOFOLLOW) != 0) return 1; // deleted
+  if ((st.st_mode & S_IFMT) != (entry->mode & S_IFMT)) return 1;                     // typechange
+  if (queue->filemode && S_ISREG(st.st_mode) &&
+      !(st.st_mode & S_IXUSR) != !(entry->mode & S_IXUSR)) return 1;
+  // a size of 0 may mean git smudged a racy entry, so then look closer
+  if ((uint32_t) st.st_size != entry->file_size && entry->file_size != 0) return 1;
+
+  // a file rewritten with the same size and its mtime put back, as by
+  // touch -r or some editors, still has a new ctime, and perhaps inode
+  struct timespec mtime = STAT_MTIME(&st);
+  struct timespec change_time = STAT_CTIME(&st);
+  int stat_matches =
+    (uint32_t) st.st_size == entry->file_size &&
+    mtime.tv_sec == entry->mtime.seconds &&
+    (entry->mtime.nanoseconds == 0 || (uint32_t) mtime.tv_nsec == entry->mtime.nanoseconds) &&
+    (!queue->trustctime ||
+     (change_time.tv_sec == entry->ctime.seconds &&
+      (entry->ctime.nanoseconds == 0 || (uint32_t) change_time.tv_nsec == entry->ctime.nanoseconds))) &&
+    (entry->ino == 0 || (uint32_t) st.st_ino == entry->ino);
+  int is_racy =
+    mtime.tv_sec > queue->index_mtime.tv_sec ||
+    (mtime.tv_sec == queue->index_mtime.tv_sec && mtime.tv_nsec >= queue->index_mtime.tv_nsec);
+  if (stat_matches && !is_racy) return 0;
+
+  git_oid oid;
+  if (S_ISLNK(st.st_mode)) {
+    char target[PATH_MAX];
+    ssize_t len = readlinkat(queue->root_fd, entry->path, target, sizeof(target));
+    if (len < 0 || git_odb_hash(&oid, target, (size_t) len, GIT_OBJECT_BLOB) != 0) return 1;
   }
+  else if (git_repository_hashfile(&oid, worker->repo, entry->path, GIT_OBJECT_BLOB, NULL) != 0) {
+    return 1;
+  }
+  return !git_oid_equal(&oid, &entry->id);
+}
 
-  if (git_repository_head(&head_ref, repo) != 0) {
-    goto cleanup; // Failed to get repository head, cleanup and exit
+/**
+ * Helper: Does the untracked directory in worker->path hold anything
+ * which isn't ignored? Like git, a directory containing only ignored
+ * files or empty directories isn't reported.
+ */
+int __dir_has_content(struct StatusWorker *worker, size_t len) {
+  DIR *dir = __open_workdir_dir(worker->queue, worker->path);
+  if (!dir) return 0;
+
+  int found = 0;
+  struct dirent *entry;
+  while (!found && (entry = readdir(dir)) != NULL) {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+
+    size_t child_len = __path_push(worker->path, len, entry->d_name);
+    if (child_len == 0) continue;
+
+    if (__is_dir(worker->queue, entry, worker->path)) {
+      found = !__is_ignored(worker->repo, worker->path, child_len, 1) &&
+        __dir_has_content(worker, child_len);
+    }
+    else {
+      found = !__is_ignored(worker->repo, worker->path, child_len, 0);
+    }
+    worker->path[len] = '\0';
   }
-  head_oid = git_reference_target(head_ref);
+  closedir(dir);
+  return found;
+}
 
-  // Success, update state
-  state->repo_path = git_repository_path;
-  state->repo_obj = repo;
-  state->head_ref = head_ref;
-  state->head_oid = head_oid;
+/**
+ * Helper: Count untracked files below the directory in worker->path,
+ * which has tracked content. An untracked directory counts as one,
+ * as with git_status_list_new() without RECURSE_UNTRACKED_DIRS.
+ */
+void __count_untracked(struct StatusWorker *worker, size_t len) {
+  DIR *dir = __open_workdir_dir(worker->queue, worker->path);
+  if (!dir) return;
 
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    if (strcmp(entry->d_name, ".")    == 0 ||
+        strcmp(entry->d_name, "..")   == 0 ||
+        strcmp(entry->d_name, ".git") == 0) continue;
+
+    size_t child_len = __path_push(worker->path, len, entry->d_name);
+    if (child_len == 0) continue;
+
+    int is_dir = __is_dir(worker->queue, entry, worker->path);
+    if (__index_has_path(worker->queue, worker->path, is_dir)) {
+      // tracked - already compared against the index
+    }
+    else if (is_dir) {
+      if (__index_has_dir(worker->queue, worker->path, child_len)) {
+        __count_untracked(worker, child_len);
+      }
+      else if (!__is_ignored(worker->repo, worker->path, child_len, 1) &&
+               __dir_has_content(worker, child_len)) {
+        worker->untracked++;
+      }
+    }
+    else if (!__is_ignored(worker->repo, worker->path, child_len, 0)) {
+      worker->untracked++;
+    }
+    worker->path[len] = '\0';
+  }
+  closedir(dir);
+}
+
+/**
+ * Helper: Thread body. Claims work items until there are none left.
+ */
+void *__status_worker(void *arg) {
+  struct StatusWorker *worker = arg;
+  struct StatusWorkQueue *queue = worker->queue;
+
+  size_t i;
+  while ((i = __atomic_fetch_add(&queue->next_item, 1, __ATOMIC_RELAXED)) < queue->item_count) {
+    const struct StatusWorkItem *item = &queue->items[i];
+
+    for (size_t j = 0; j < item->count; j++) {
+      if (git_index_entry_stage(item->entries[j]) != 0) continue; // counted as a conflict
+      if (__entry_is_modified(worker, item->entries[j])) worker->modified++;
+    }
+
+    // untracked files in the root are counted before the workers start
+    if (item->name == NULL) continue;
+
+    size_t len = __path_push(worker->path, 0, item->name);
+    if (len == 0) continue;
+
+    if (item->count > 0) {
+      __count_untracked(worker, len);
+    }
+    else if (!__is_ignored(worker->repo, worker->path, len, 1) &&
+             __dir_has_content(worker, len)) {
+      worker->untracked++;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Helper: Order work items by size, largest first
+ */
+int __compare_work_items(const void *a, const void *b) {
+  const struct StatusWorkItem *item_a = a;
+  const struct StatusWorkItem *item_b = b;
+  if (item_a->count == item_b->count) return 0;
+  return item_a->count < item_b->count ? 1 : -1;
+}
+
+/**
+ * Helper: Append a work item, growing the array as needed
+ */
+int __add_work_item(struct StatusWorkQueue *queue, size_t *capacity,
+                    char *name, const git_index_entry **entries, size_t count) {
+  if (queue->item_count == *capacity) {
+    size_t new_capacity = *capacity ? *capacity * 2 : 64;
+    struct StatusWorkItem *items = realloc(queue->items, new_capacity * sizeof(*items));
+    if (!items) return ERROR;
+    queue->items = items;
+    *capacity = new_capacity;
+  }
+  queue->items[queue->item_count++] = (struct StatusWorkItem) { name, entries, count };
   return SUCCESS;
+}
 
- cleanup:
-  if (repo != NULL) {
-    git_repository_free(repo);
+/**
+ * Helper: Count modified and untracked files and conflicts using
+ * state->status_threads threads.
+ *
+ * @return SUCCESS, or FAILURE if the caller should fall back to
+ *         git_status_list_new()
+ */
+int __get_workdir_status_parallel(struct CurrentState *state) {
+  const char *workdir = git_repository_workdir(state->repo_obj);
+  if (workdir == NULL) return FAILURE; // bare repository
+
+  git_index *index = NULL;
+  if (git_repository_index(&index, state->repo_obj) != 0) return FAILURE;
+
+  int result = FAILURE;
+  struct StatusWorkQueue queue = { .root_fd = -1 };
+  const git_index_entry **root_entries = NULL;
+  struct StatusWorker *workers = NULL;
+  size_t worker_count = 0;
+  size_t capacity = 0;
+  int conflicts = 0;
+  int untracked = 0;
+
+  queue.root_fd = open(workdir, O_RDONLY | O_DIRECTORY);
+  if (queue.root_fd < 0) goto cleanup;
+
+  char index_path[PATH_MAX];
+  struct stat index_stat;
+  snprintf(index_path, sizeof(index_path), "%sindex", git_repository_path(state->repo_obj));
+  if (stat(index_path, &index_stat) == 0) queue.index_mtime = STAT_MTIME(&index_stat);
+
+  // core.filemode and core.trustctime default to true, as in git
+  git_config *config = NULL;
+  queue.filemode   = 1;
+  queue.trustctime = 1;
+  if (git_repository_config_snapshot(&config, state->repo_obj) == 0) {
+    git_config_get_bool(&queue.filemode, config, "core.filemode");
+    git_config_get_bool(&queue.trustctime, config, "core.trustctime");
+    git_config_free(config);
   }
-  if (git_repository_path != NULL && state->repo_path == NULL) {
-    free((void *)git_repository_path);
+
+  // The index is sorted by path, so everything below a top-level
+  // directory is one contiguous run. Files in the root are not, as
+  // they sort in between the directories.
+  queue.entry_count = git_index_entrycount(index);
+  queue.entries = malloc((queue.entry_count + 1) * sizeof(*queue.entries));
+  root_entries  = malloc((queue.entry_count + 1) * sizeof(*root_entries));
+  if (!queue.entries || !root_entries) goto cleanup;
+
+  const char *last_conflict = "";
+  for (size_t i = 0; i < queue.entry_count; i++) {
+    queue.entries[i] = git_index_get_byindex(index, i);
+    if (git_index_entry_stage(queue.entries[i]) != 0 &&
+        strcmp(queue.entries[i]->path, last_conflict) != 0) {
+      last_conflict = queue.entries[i]->path;
+      conflicts++;
+    }
+  }
+
+  size_t root_count = 0;
+  for (size_t i = 0; i < queue.entry_count; ) {
+    const char *path = queue.entries[i]->path;
+    const char *slash = strchr(path, '/');
+    if (slash == NULL) {
+      root_entries[root_count++] = queue.entries[i++];
+      continue;
+    }
+
+    size_t prefix_len = slash - path + 1;
+    size_t j = i + 1;
+    while (j < queue.entry_count && strncmp(queue.entries[j]->path, path, prefix_len) == 0) j++;
+
+    char *name = strndup(path, prefix_len - 1);
+    if (!name || __add_work_item(&queue, &capacity, name, &queue.entries[i], j - i) != SUCCESS) {
+      free(name);
+      goto cleanup;
+    }
+    i = j;
+  }
+  if (root_count > 0 &&
+      __add_work_item(&queue, &capacity, NULL, root_entries, root_count) != SUCCESS) {
+    goto cleanup;
+  }
+
+  // Untracked directories in the root get work items of their own,
+  // untracked files in the root are counted right away.
+  DIR *root = __open_workdir_dir(&queue, ".");
+  if (!root) goto cleanup;
+
+  char path[PATH_MAX];
+  struct dirent *entry;
+  while ((entry = readdir(root)) != NULL) {
+    if (strcmp(entry->d_name, ".")    == 0 ||
+        strcmp(entry->d_name, "..")   == 0 ||
+        strcmp(entry->d_name, ".git") == 0) continue;
+
+    size_t len = __path_push(path, 0, entry->d_name);
+    if (len == 0) continue;
+
+    int is_dir = __is_dir(&queue, entry, path);
+    if (__index_has_path(&queue, path, is_dir)) continue;
+
+    if (is_dir) {
+      if (__index_has_dir(&queue, path, len)) continue; // already a work item
+
+      char *name = strdup(path);
+      if (!name || __add_work_item(&queue, &capacity, name, NULL, 0) != SUCCESS) {
+        free(name);
+        closedir(root);
+        goto cleanup;
+      }
+    }
+    else if (!__is_ignored(state->repo_obj, path, len, 0)) {
+      untracked++;
+    }
+  }
+  closedir(root);
+
+  qsort(queue.items, queue.item_count, sizeof(*queue.items), __compare_work_items);
+
+  // Start the workers. The calling thread does its share too.
+  worker_count = (size_t) state->status_threads;
+  if (worker_count > queue.item_count) worker_count = queue.item_count;
+  if (worker_count == 0) worker_count = 1;
+
+  workers = calloc(worker_count, sizeof(*workers));
+  if (!workers) goto cleanup;
+
+  const char *git_dir = git_repository_path(state->repo_obj);
+  for (size_t i = 0; i < worker_count; i++) {
+    workers[i].queue = &queue;
+    if (git_repository_open(&workers[i].repo, git_dir) != 0) goto cleanup;
+  }
+
+  size_t started = 1;
+  for (; started < worker_count; started++) {
+    if (pthread_create(&workers[started].thread, NULL, __status_worker, &workers[started]) != 0) break;
+  }
+  __status_worker(&workers[0]);
+
+  int modified = 0;
+  for (size_t i = 0; i < started; i++) {
+    if (i > 0) pthread_join(workers[i].thread, NULL);
+    modified  += workers[i].modified;
+    untracked += workers[i].untracked;
   }
 
+  state->modified_num  = modified;
+  state->untracked_num = untracked;
+  state->conflict_num  = conflicts;
+  result = SUCCESS;
+
+ cleanup:
+  if (workers) {
+    for (size_t i = 0; i < worker_count; i++) {
+      if (workers[i].repo) git_repository_free(workers[i].repo);
+    }
+    free(workers);
+  }
+  for (size_t i = 0; i < queue.item_count; i++) {
+    free(queue.items[i].name);
+  }
+  free(queue.items);
+  free(queue.entries);
+  free(root_entries);
+  if (queue.root_fd >= 0) close(queue.root_fd);
+  git_index_free(index);
   return result;
 }
 
+
 /**
  * Helper: Get the current Git repository's status, including staged
  * and modified changes, and conflicts.
  */
 int __get_repo_status(struct CurrentState *state) {
-  if (state->head_ref == NULL) return ERROR_GIT_NO_HEAD_REF;
+  if (state->head_oid == NULL) return ERROR_GIT_NO_HEAD_REF;
+
+  // With the parallel engine, libgit2 only has to compare HEAD with
+  // the index - the working tree has been taken care of already.
+  int workdir_done =
+    state->status_threads > 0 &&
+    __get_workdir_status_parallel(state) == SUCCESS;
 
   // First get the status-list which we'll iterate through
 #pragma GCC diagnostic push
@@ -212,14 +1012,11 @@ int __get_repo_status(struct CurrentState *state) {
   git_status_options opts = GIT_STATUS_OPTIONS_INIT;
 #pragma GCC diagnostic pop
 
-  opts.show = GIT_STATUS_SHOW_INDEX_AND_WORKDIR;
+  opts.show = workdir_done ? GIT_STATUS_SHOW_INDEX_ONLY : GIT_STATUS_SHOW_INDEX_AND_WORKDIR;
   opts.flags = GIT_STATUS_OPT_RENAMES_HEAD_TO_INDEX | GIT_STATUS_OPT_INCLUDE_UNTRACKED;
 
   git_status_list *status_list = NULL;
   if (git_status_list_new(&status_list, state->repo_obj, &opts) != 0) {
-    git_reference_free(state->head_ref);
-    git_repository_free(state->repo_obj);
-    free((void *) state->repo_path);
     return FAILURE_IS_NOT_GIT_REPO;
   }
   state->status_list = status_list;
@@ -263,11 +1060,12 @@ int __get_repo_status(struct CurrentState *state) {
   }
 
   state->staged_num    = staged_changes;
-  state->modified_num  = modified_changes;
-  state->untracked_num = untracked;
-  state->conflict_num  = conflicts;
+  if (!workdir_done) {
+    state->modified_num  = modified_changes;
+    state->untracked_num = untracked;
+    state->conflict_num  = conflicts;
+  }
 
-  __check_for_interactive_rebase(state);
   return SUCCESS;
 }
 
@@ -277,10 +1075,10 @@ int __get_repo_status(struct CurrentState *state) {
  * many commits it is ahead or behind.
  */
 int __get_repo_divergence(struct CurrentState *state) {
-  if (state->head_ref == NULL) return ERROR_GIT_NO_HEAD_REF;
+  if (state->head_oid == NULL) return ERROR_GIT_NO_HEAD_REF;
 
-  char full_remote_branch_name[128];
-  sprintf(full_remote_branch_name, "refs/remotes/origin/%s", git_reference_shorthand(state->head_ref));
+  char full_remote_branch_name[PATH_MAX];
+  snprintf(full_remote_branch_name, sizeof(full_remote_branch_name), "refs/remotes/origin/%s", state->branch_name);
 
   git_reference *upstream_ref = NULL;
   const git_oid *upstream_oid;
@@ -403,6 +1201,439 @@ int __get_aws_token_file(char **aws_token_file) {
 
 
 
+/**
+ * Helper: Find the nearest directory, from start up to top, with any
+ * of the wanted markers
+ * @param dir  Set to the directory, PATH_MAX long.
+ * @return the wanted markers found in it, or 0 if none were found
+ */
+unsigned __find_markers(const char *start, const char *top, unsigned wanted, char *dir) {
+  snprintf(dir, PATH_MAX, "%s", start);
+  while (dir[0] != '\0') {
+    unsigned markers = __markers_in(dir) & wanted;
+    if (markers) return markers;
+    if (strcmp(dir, top) == 0 || __parent_dir(dir) != SUCCESS) break;
+  }
+  dir[0] = '\0';
+  return 0;
+}
+
+/**
+ * Helper: Find the nearest directory, from the cwd up to top, with any
+ * of the wanted markers, with the ones noted on the way up to the
+ * repository if they were
+ * @param top  The repository, or "/".
+ * @param dir  Set to the directory, PATH_MAX long.
+ * @return the wanted markers found in it, or 0 if none were found
+ */
+unsigned __find_cwd_markers(const struct CurrentState *state, const char *top, unsigned wanted, char *dir) {
+  if (!state->markers_noted) return __find_markers(state->cwd_full, top, wanted, dir);
+
+  size_t nearest = 0;
+  for (size_t i = 0; i < MARKER_COUNT; i++) {
+    if ((wanted & MARKER_BIT(i)) && state->marker_dir_length[i] > nearest) nearest = state->marker_dir_length[i];
+  }
+  if (nearest > 0) {
+    unsigned markers = 0;
+    for (size_t i = 0; i < MARKER_COUNT; i++) {
+      if ((wanted & MARKER_BIT(i)) && state->marker_dir_length[i] == nearest) markers |= MARKER_BIT(i);
+    }
+    snprintf(dir, PATH_MAX, "%.*s", (int) nearest, state->cwd_full);
+    return markers;
+  }
+
+  // the walk stopped at the repository; go on above it
+  char above[PATH_MAX];
+  snprintf(above, sizeof(above), "%s", state->is_git_repo == 1 ? state->repo_path : "/");
+  if (strcmp(above, top) == 0 || __parent_dir(above) != SUCCESS) {
+    dir[0] = '\0';
+    return 0;
+  }
+  return __find_markers(above, top, wanted, dir);
+}
+
+
+/**
+   Size of the part of a file kept in a FileCache
+*/
+#define FILE_CACHE_TEXT_SIZE 4096
+
+/**
+   The start of a file, as it was last read. These last as long as the
+   process, so only prompt2 --serve and the zsh module read the files
+   less often.
+*/
+struct FileCache {
+  char            path[PATH_MAX];
+  struct timespec mtime;
+  off_t           size;
+  char            text[FILE_CACHE_TEXT_SIZE];
+};
+static struct FileCache pyvenv_cfg_cache;
+static struct FileCache python_version_cache;
+static struct FileCache conda_meta_cache; // the name of the python package in conda-meta
+static struct FileCache nvmrc_cache;
+static struct FileCache node_header_cache;
+
+/**
+ * Helper: The start of a file, read again only if it has changed since
+ * it was last read
+ * @return the text, or NULL if the file can't be read
+ */
+const char *__cached_file(struct FileCache *cache, const char *path) {
+  struct stat st;
+  if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return NULL;
+  if (strcmp(cache->path, path) == 0 && cache->size == st.st_size &&
+      cache->mtime.tv_sec == STAT_MTIME(&st).tv_sec &&
+      cache->mtime.tv_nsec == STAT_MTIME(&st).tv_nsec) {
+    return cache->text;
+  }
+
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return NULL;
+  ssize_t length = read(fd, cache->text, sizeof(cache->text) - 1);
+  close(fd);
+  if (length < 0) return NULL;
+
+  cache->text[length] = '\0';
+  snprintf(cache->path, sizeof(cache->path), "%s", path);
+  cache->mtime = STAT_MTIME(&st);
+  cache->size  = st.st_size;
+  return cache->text;
+}
+
+/**
+ * Helper: The value of a `key = value` line of a config file, such as
+ * pyvenv.cfg
+ * @return SUCCESS, or FAILURE if the key isn't there
+ */
+int __cfg_value(const char *text, const char *key, char *value, size_t size) {
+  size_t key_length = strlen(key);
+  for (const char *line = text; line && *line; line = strchr(line, '\n'), line = line ? line + 1 : NULL) {
+    line += strspn(line, " \t");
+    if (strncmp(line, key, key_length) != 0) continue;
+    const char *rest = line + key_length + strspn(line + key_length, " \t");
+    if (*rest != '=') continue;
+    rest += 1 + strspn(rest + 1, " \t");
+    size_t length = strcspn(rest, "\r\n");
+    while (length > 0 && (rest[length - 1] == ' ' || rest[length - 1] == '\t')) length--;
+    if (length >= 2 && (rest[0] == '\'' || rest[0] == '"') && rest[length - 1] == rest[0]) {
+      rest++;
+      length -= 2;
+    }
+    snprintf(value, size, "%.*s", (int) length, rest);
+    return SUCCESS;
+  }
+  return FAILURE;
+}
+
+/**
+ * Helper: Copy the first word of a version file, such as
+ * .python-version, without a leading 'v'
+ */
+void __first_word(const char *text, char *word, size_t size) {
+  text += strspn(text, " \t\r\n");
+  if (text[0] == 'v' && isdigit((unsigned char) text[1])) text++;
+  snprintf(word, size, "%.*s", (int) strcspn(text, " \t\r\n#"), text);
+}
+
+/**
+ * Helper: Keep the first three parts of a version, e.g. "3.11.4" of
+ * "3.11.4.final.0"
+ */
+void __major_minor_patch(char *version) {
+  char *dot = version;
+  for (int i = 0; i < 3 && dot; i++) dot = strchr(dot + 1, '.');
+  if (dot) *dot = '\0';
+}
+
+/**
+ * Helper: An environment variable, as the shell which asked for the
+ * prompt has it. A long-lived prompt2 --serve was started with the
+ * shell's environment of then, so the shell sends the variables which
+ * change along with its requests; an empty value unsets one.
+ * @return the value, or NULL if it isn't set
+ */
+const char *__state_getenv(const struct CurrentState *state, const char *name) {
+  size_t name_length = strlen(name);
+  for (const char *const *variable = state->environment; variable && *variable; variable++) {
+    if (strncmp(*variable, name, name_length) == 0 && (*variable)[name_length] == '=') {
+      const char *value = *variable + name_length + 1;
+      return value[0] ? value : NULL;
+    }
+  }
+  return getenv(name);
+}
+
+/**
+ * Helper: Find an executable in $PATH, and resolve its symlinks
+ * @param real_path  Set to the resolved path, PATH_MAX long.
+ * @return SUCCESS, or FAILURE if it isn't in $PATH
+ */
+int __find_in_path(const struct CurrentState *state, const char *name, char *real_path) {
+  const char *path = __state_getenv(state, "PATH");
+  while (path && *path) {
+    size_t length = strcspn(path, ":");
+    char candidate[PATH_MAX];
+    snprintf(candidate, sizeof(candidate), "%.*s/%s", (int) length, length ? path : ".", name);
+    if (access(candidate, X_OK) == 0 && realpath(candidate, real_path)) return SUCCESS;
+    path += length + (path[length] == ':');
+  }
+  return FAILURE;
+}
+
+/**
+ * Helper: The version of python in a conda environment, from the name
+ * of its package in conda-meta, e.g. python-3.11.4-h955ad1f_0.json
+ */
+int __conda_python_version(const char *prefix, char *version, size_t size) {
+  char meta_dir[PATH_MAX];
+  snprintf(meta_dir, sizeof(meta_dir), "%s/conda-meta", prefix);
+  struct stat st;
+  if (stat(meta_dir, &st) != 0) return FAILURE;
+
+  // the directory is listed again when a package is added or removed
+  struct FileCache *cache = &conda_meta_cache;
+  if (strcmp(cache->path, meta_dir) != 0 ||
+      cache->mtime.tv_sec != STAT_MTIME(&st).tv_sec ||
+      cache->mtime.tv_nsec != STAT_MTIME(&st).tv_nsec) {
+    DIR *dir = opendir(meta_dir);
+    if (dir == NULL) return FAILURE;
+    cache->text[0] = '\0';
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+      if (strncmp(entry->d_name, "python-", 7) == 0 && isdigit((unsigned char) entry->d_name[7])) {
+        snprintf(cache->text, sizeof(cache->text), "%s", entry->d_name + 7);
+        break;
+      }
+    }
+    closedir(dir);
+    snprintf(cache->path, sizeof(cache->path), "%s", meta_dir);
+    cache->mtime = STAT_MTIME(&st);
+  }
+
+  if (cache->text[0] == '\0') return FAILURE;
+  snprintf(version, size, "%.*s", (int) strcspn(cache->text, "-"), cache->text);
+  return SUCCESS;
+}
+
+/**
+ * Helper: The version of the node whose executable is at real_path,
+ * from the node_version.h installed along with it
+ */
+int __node_header_version(const char *real_path, char *version, size_t size) {
+  char header[PATH_MAX];
+  snprintf(header, sizeof(header), "%s", real_path);
+  if (__parent_dir(header) != SUCCESS || __parent_dir(header) != SUCCESS) return FAILURE;
+  size_t length = strlen(header);
+  snprintf(header + length, sizeof(header) - length, "/include/node/node_version.h");
+
+  const char *text = __cached_file(&node_header_cache, header);
+  if (text == NULL) return FAILURE;
+
+  int parts[3];
+  static const char *defines[3] = {
+    "#define NODE_MAJOR_VERSION", "#define NODE_MINOR_VERSION", "#define NODE_PATCH_VERSION",
+  };
+  for (int i = 0; i < 3; i++) {
+    const char *define = strstr(text, defines[i]);
+    if (define == NULL || sscanf(define + strlen(defines[i]), "%d", &parts[i]) != 1) return FAILURE;
+  }
+  snprintf(version, size, "%d.%d.%d", parts[0], parts[1], parts[2]);
+  return SUCCESS;
+}
+
+
+/**
+   The most kubeconfig files in $KUBECONFIG which are read
+*/
+#define KUBECONFIG_MAX_FILES 16
+
+/**
+   The kubeconfig files, as they are when stat()ed
+*/
+struct KubeconfigFiles {
+  char            paths[PATH_MAX]; // $KUBECONFIG, or ~/.kube/config, split at the ':'s
+  const char     *path[KUBECONFIG_MAX_FILES];
+  size_t          count;
+  struct timespec mtime[KUBECONFIG_MAX_FILES];
+  off_t           size[KUBECONFIG_MAX_FILES]; // -1 if the file doesn't exist
+};
+
+/**
+   The kubernetes context last read, and the files it was read from.
+   It lasts as long as the process, so only prompt2 --serve and the
+   zsh module read the files less often.
+*/
+static struct {
+  struct KubeconfigFiles files;
+  char                   context[K8S_NAME_SIZE];
+  char                   context_namespace[K8S_NAME_SIZE];
+  int                    is_set;
+} k8s_cache;
+
+/**
+ * Helper: Find the kubeconfig files, and stat them
+ * @return SUCCESS, or FAILURE if there are none
+ */
+int __kubeconfig_files(const struct CurrentState *state, struct KubeconfigFiles *files) {
+  const char *kubeconfig = __state_getenv(state, "KUBECONFIG");
+  const char *home_dir   = getenv("HOME");
+  if (kubeconfig && kubeconfig[0]) {
+    snprintf(files->paths, sizeof(files->paths), "%s", kubeconfig);
+  }
+  else if (home_dir) {
+    snprintf(files->paths, sizeof(files->paths), "%s/.kube/config", home_dir);
+  }
+  else {
+    return FAILURE;
+  }
+
+  files->count = 0;
+  char *saveptr;
+  for (char *path = strtok_r(files->paths, ":", &saveptr);
+       path && files->count < KUBECONFIG_MAX_FILES;
+       path = strtok_r(NULL, ":", &saveptr)) {
+    struct stat st;
+    size_t i = files->count++;
+    files->path[i] = path;
+    if (stat(path, &st) == 0) {
+      files->mtime[i] = STAT_MTIME(&st);
+      files->size[i]  = st.st_size;
+    }
+    else {
+      files->mtime[i] = (struct timespec) { 0, 0 };
+      files->size[i]  = -1;
+    }
+  }
+  return files->count > 0 ? SUCCESS : FAILURE;
+}
+
+/**
+ * Helper: Check if the kubeconfig files are the same as before, and
+ * unchanged
+ */
+int __same_kubeconfig_files(const struct KubeconfigFiles *a, const struct KubeconfigFiles *b) {
+  if (a->count != b->count) return 0;
+  for (size_t i = 0; i < a->count; i++) {
+    if (strcmp(a->path[i], b->path[i]) != 0 || a->size[i] != b->size[i] ||
+        a->mtime[i].tv_sec != b->mtime[i].tv_sec || a->mtime[i].tv_nsec != b->mtime[i].tv_nsec) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Helper: Copy the value of a YAML `key: value`, without its quotes,
+ * or a comment after it
+ */
+void __yaml_value(const char *value, char *out, size_t size) {
+  value += strspn(value, " \t");
+  size_t length;
+  if (value[0] == '"' || value[0] == '\'') {
+    const char *end = strchr(value + 1, value[0]);
+    value++;
+    length = end ? (size_t) (end - value) : strcspn(value, "\r\n");
+  }
+  else {
+    const char *comment = strstr(value, " #");
+    length = comment ? (size_t) (comment - value) : strcspn(value, "\r\n");
+    while (length > 0 && (value[length - 1] == ' ' || value[length - 1] == '\t')) length--;
+  }
+  snprintf(out, size, "%.*s", (int) length, value);
+}
+
+/**
+ * Helper: Scan a kubeconfig, line by line, for its current-context
+ * or, given a context, for the namespace of the context of that name
+ * ("default" if it has none).
+ *
+ * This is no YAML parser: it knows the layout kubectl writes, a key
+ * on each line and lists of mappings starting with "- ".
+ *
+ * @param context  NULL to look for the current-context
+ * @param found    Set to what was looked for, if found.
+ * @return SUCCESS, or FAILURE if it isn't in the file
+ */
+int __scan_kubeconfig(const char *path, const char *context, char *found, size_t size) {
+  FILE *file = fopen(path, "r");
+  if (!file) return FAILURE;
+
+  char *line = NULL;
+  size_t capacity = 0;
+  int in_contexts  = 0;  // in the top-level list of contexts
+  int item_indent  = -1; // of the keys of a context in the list
+  int in_block     = 0;  // in the `context:` mapping of a context
+  int block_indent = -1; // of the keys in it
+  char name[K8S_NAME_SIZE] = "";
+  char namespace_name[K8S_NAME_SIZE] = "";
+  int retval = FAILURE;
+
+  while (1) {
+    int at_end = getline(&line, &capacity, file) == -1;
+    char *key = at_end ? NULL : line + strspn(line, " ");
+    if (key && (key[0] == '#' || key[0] == '\0' || strchr("\r\n", key[0]))) continue;
+
+    // a new context starts with a "- " left of the keys of the last
+    // one; lists further in are part of it
+    int is_item = key && key[0] == '-' && (key[1] == ' ' || key[1] == '\r' || key[1] == '\n');
+    int is_context = in_contexts && is_item && (item_indent == -1 || key - line < item_indent);
+    if (is_item) key += 1 + strspn(key + 1, " ");
+    int indent = key ? (int) (key - line) : 0;
+    int is_top_level = key && line[0] != ' ' && line[0] != '-';
+
+    // a context ends where the next one, or the list, does
+    if (context && in_contexts && (at_end || is_context || is_top_level) && strcmp(name, context) == 0) {
+      snprintf(found, size, "%s", namespace_name[0] ? namespace_name : "default");
+      retval = SUCCESS;
+      break;
+    }
+    if (at_end) break;
+
+    char *colon = strchr(key, ':');
+    if (colon == NULL || !strchr(" \t\r\n", colon[1])) continue;
+    size_t key_length = colon - key;
+
+    if (is_top_level) {
+      in_contexts = key_length == 8 && strncmp(key, "contexts", 8) == 0;
+      item_indent = -1;
+      if (!context && key_length == 15 && strncmp(key, "current-context", 15) == 0) {
+        __yaml_value(colon + 1, found, size);
+        if (found[0]) {
+          retval = SUCCESS;
+          break;
+        }
+      }
+      continue;
+    }
+    if (!context || !in_contexts) continue;
+
+    if (is_context) {
+      item_indent = indent;
+      name[0] = namespace_name[0] = '\0';
+    }
+    if (indent == item_indent) {
+      if (key_length == 4 && strncmp(key, "name", 4) == 0) {
+        __yaml_value(colon + 1, name, sizeof(name));
+      }
+      in_block = key_length == 7 && strncmp(key, "context", 7) == 0;
+      block_indent = -1;
+    }
+    else if (in_block && indent > item_indent) {
+      if (block_indent == -1) block_indent = indent;
+      if (indent == block_indent && key_length == 9 && strncmp(key, "namespace", 9) == 0) {
+        __yaml_value(colon + 1, namespace_name, sizeof(namespace_name));
+      }
+    }
+  }
+
+  free(line);
+  fclose(file);
+  return retval;
+}
+
+
 /* ================================================== */
 /* Exported functions                                 */
 /* ================================================== */
@@ -410,13 +1641,19 @@ int __get_aws_token_file(char **aws_token_file) {
 /**
  * Sets up CurrentState so that they are useable.
  */
-void initialise_state(struct CurrentState *state) {
+void initialise_state(struct CurrentState *state, const char *cwd) {
   // Internal things. Uninteresting for user
   state->repo_obj                    = NULL;
   state->repo_path                   = NULL;
-  state->head_ref                    = NULL;
+  state->git_dir                     = NULL;
+  state->head_ref_name               = NULL;
   state->head_oid                    = NULL;
   state->status_list                 = NULL;
+  state->status_threads              = 0;
+  state->environment                 = NULL;
+  state->record_markers              = 0;
+  state->markers_noted               = 0;
+  memset(state->marker_dir_length, 0, sizeof(state->marker_dir_length));
 
 
   // External stuff. User prolly interested in these
@@ -436,6 +1673,12 @@ void initialise_state(struct CurrentState *state) {
   state->has_upstream                = -1;
   state->conflict_num                = -1;
   state->is_rebase_in_progress       = -1;
+  state->is_merge_in_progress        = -1;
+  state->is_cherry_pick_in_progress  = -1;
+  state->is_revert_in_progress       = -1;
+  state->is_bisect_in_progress       = -1;
+  state->rebase_step[0]              = '\0';
+  state->repo_state                  = "";
 
   state->ahead_num                   = -1;
   state->behind_num                  = -1;
@@ -447,50 +1690,135 @@ void initialise_state(struct CurrentState *state) {
   state->aws_token_remaining_hours   = -1;
   state->aws_token_remaining_minutes = -1;
 
+  state->project_type                = "";
+  state->project_name                = "";
+  state->k8s_context[0]              = '\0';
+  state->k8s_namespace[0]            = '\0';
+
+  state->env_venv[0]                 = '\0';
+  state->env_conda[0]                = '\0';
+  state->env_python_version[0]       = '\0';
+  state->env_node_version[0]         = '\0';
+
+  state->exit_status                 = -1;
+  state->command_duration_ms         = -1;
+
 
   // get current working directory and basename
-  static char cwd_path[PATH_MAX];
-  getcwd(cwd_path, sizeof(cwd_path));
-  state->cwd_full = cwd_path;
+  if (cwd) {
+    snprintf(state->cwd_buffer, sizeof(state->cwd_buffer), "%s", cwd);
+  }
+  else if (!getcwd(state->cwd_buffer, sizeof(state->cwd_buffer))) {
+    state->cwd_buffer[0] = '\0';
+  }
+  state->cwd_full = state->cwd_buffer;
 
-  static char wd[PATH_MAX];
-  sprintf(wd, "%s", basename(cwd_path));
-  state->cwd_basename = wd;
+  // basename() may modify its argument, so give it a copy
+  snprintf(state->cwd_basename_buffer, sizeof(state->cwd_basename_buffer),
+           "%s", basename(strcpy(state->cwd_git_buffer, state->cwd_buffer)));
+  state->cwd_basename = state->cwd_basename_buffer;
+  state->cwd_git_path = "";
 }
 
 
 /**
- * Gather all git-related context.
+ * Gather the git context that can be read straight from the .git
+ * directory.
  */
+int gather_git_head_context(struct CurrentState *state) {
+  // already done
+  if (state->is_git_repo != -1) {
+    return ! state->is_git_repo;
+  }
 
-int gather_git_context(struct CurrentState *state) {
-  // in state, 0 means false, 1 means true.
-  // when functions return 0, it's true, and 1 means false.
-  // very confusing.
-  state->is_git_repo = ! __is_git_repo(".");
+  char work_tree[PATH_MAX];
+  char git_dir[PATH_MAX];
+  state->is_git_repo = ! __find_git_dir(state->cwd_full, work_tree, git_dir,
+                                       state->record_markers ? state->marker_dir_length : NULL);
+  state->markers_noted = state->record_markers;
 
   // if not a git repo
   if (state->is_git_repo == 0) {
     return ! state->is_git_repo;
   }
 
-  __populate_repo_context(state, ".");
-  __get_repo_name(state);
-  __get_branch_name(state);
-  __get_repo_status(state);
-  __get_repo_divergence(state);
+  state->repo_path = strdup(work_tree);
+  state->git_dir   = strdup(git_dir);
+
+  char common_dir[PATH_MAX];
+  __find_common_dir(git_dir, common_dir);
+  __probe_repo_state(state);
 
+  // HEAD is either "ref: refs/heads/<branch>", or a commit id when detached
+  char head[PATH_MAX];
+  char head_path[PATH_MAX + sizeof("/HEAD")];
+  snprintf(head_path, sizeof(head_path), "%s/HEAD", git_dir);
+  if (__read_first_line(head_path, head, sizeof(head)) == SUCCESS &&
+      strncmp(head, "ref: ", 5) == 0) {
+    state->head_ref_name = strdup(head + 5);
+  }
+  else {
+    state->head_ref_name = strdup("HEAD");
+  }
 
-  // figure out if this repo (if it is a repo) is a mature one or a nascent. 
-  // A nascent repo is one where 'git init' has been run but no 'git commit'
+  // figure out if this repo is a mature one or a nascent. A nascent
+  // repo is one where 'git init' has been run but no 'git commit'
   state->is_nascent_repo = 0;
-  if (state->is_git_repo == 1 && state->head_ref == NULL) {
+  if (__resolve_ref(git_dir, common_dir, "HEAD", &state->head_id, 0) != SUCCESS) {
     state->is_nascent_repo = 1;
+    state->repo_name   = "NO_DATA";
+    state->branch_name = "NO_DATA";
+    return ! state->is_git_repo;
+  }
+  state->head_oid = &state->head_id;
+
+  const char *slash = strrchr(state->repo_path, '/');
+  state->repo_name = slash[1] ? slash + 1 : state->repo_path;
+
+  state->branch_name = state->head_ref_name;
+  if (strncmp(state->branch_name, "refs/heads/", 11) == 0) {
+    state->branch_name += 11;
   }
 
   return ! state->is_git_repo; // If we're in a git repo return 0, else not 0
 }
 
+
+/**
+ * Resolve a ref without libgit2.
+ */
+int resolve_git_ref(const struct CurrentState *state, const char *ref, git_oid *oid) {
+  if (state->git_dir == NULL) return FAILURE;
+
+  char common_dir[PATH_MAX];
+  __find_common_dir(state->git_dir, common_dir);
+  return __resolve_ref(state->git_dir, common_dir, ref, oid, 0);
+}
+
+
+/**
+ * Gather all git-related context.
+ */
+int gather_git_context(struct CurrentState *state) {
+  // in state, 0 means false, 1 means true.
+  // when functions return 0, it's true, and 1 means false.
+  // very confusing.
+  gather_git_head_context(state);
+
+  // if not a git repo, or nothing more to know
+  if (state->is_git_repo == 0 || state->is_nascent_repo == 1) {
+    return ! state->is_git_repo;
+  }
+
+  if (__populate_repo_context(state) != SUCCESS) {
+    return ! state->is_git_repo;
+  }
+  __get_repo_status(state);
+  __get_repo_divergence(state);
+
+  return ! state->is_git_repo; // If we're in a git repo return 0, else not 0
+}
+
 /**
  * Gather regular system context
  *
@@ -510,17 +1838,14 @@ int gather_system_context(struct CurrentState *state) {
   state->gid = getgid();
 
   // Get the short-form hostname of this machine and save in state->hostname
-  char hostname[HOST_NAME_MAX];
-  if (gethostname(hostname, sizeof(hostname)) != 0) {
+  char *hostname = state->hostname_buffer;
+  if (gethostname(hostname, sizeof(state->hostname_buffer)) != 0) {
     return ERROR;
   }
+  hostname[sizeof(state->hostname_buffer) - 1] = '\0';
   // Only keep the short form of the hostname, truncate at the first dot if present
-  char *short_hostname = strtok(hostname, ".");
-  if (!short_hostname) {
-    // If the hostname does not contain a dot, use the full hostname
-    short_hostname = hostname;
-  }
-  state->hostname = strdup(short_hostname);
+  hostname[strcspn(hostname, ".")] = '\0';
+  state->hostname = hostname;
 
   return SUCCESS;
 
@@ -545,6 +1870,8 @@ int gather_aws_context(struct CurrentState *state) {
   }
 
 
+  if (lazy_load_json_c() != SUCCESS) return ERROR; // can't parse - so error
+
   FILE *file = fopen(aws_token_file, "r");
   if (!file) return ERROR; // can't read - so error
 
@@ -587,20 +1914,175 @@ int gather_aws_context(struct CurrentState *state) {
   return state->aws_token_is_valid;
 }
 
+/**
+ * Find the project the working directory is in.
+ */
+int gather_project_context(struct CurrentState *state) {
+  // the search stops where git's does
+  gather_git_head_context(state);
+  const char *top = state->is_git_repo == 1 ? state->repo_path : "/";
+
+  char *dir = state->project_root_buffer;
+  unsigned markers = __find_cwd_markers(state, top, MARKERS_PROJECT, dir);
+  if (markers == 0) return FAILURE;
+
+  size_t i = 0;
+  while (!(markers & MARKER_BIT(i))) i++;
+  state->project_type = dir_markers[i].type;
+
+  const char *slash = strrchr(dir, '/');
+  state->project_name = slash && slash[1] ? slash + 1 : dir;
+  return SUCCESS;
+}
+
+/**
+ * Gather the active python environment, and the version of python.
+ */
+int gather_python_context(struct CurrentState *state) {
+  char path[PATH_MAX + sizeof("/.python-version")];
+  const char *text;
+
+  // the virtualenv, by the prompt it was made with, or its directory
+  const char *venv = __state_getenv(state, "VIRTUAL_ENV");
+  if (venv && venv[0]) {
+    snprintf(path, sizeof(path), "%s/pyvenv.cfg", venv);
+    text = __cached_file(&pyvenv_cfg_cache, path);
+    if (text == NULL ||
+        __cfg_value(text, "prompt", state->env_venv, sizeof(state->env_venv)) != SUCCESS) {
+      const char *slash = strrchr(venv, '/');
+      snprintf(state->env_venv, sizeof(state->env_venv), "%s", slash && slash[1] ? slash + 1 : venv);
+    }
+    if (text && (__cfg_value(text, "version", state->env_python_version,
+                             sizeof(state->env_python_version)) == SUCCESS ||
+                 __cfg_value(text, "version_info", state->env_python_version,
+                             sizeof(state->env_python_version)) == SUCCESS)) {
+      __major_minor_patch(state->env_python_version);
+    }
+  }
+
+  // the conda environment
+  const char *conda_env    = __state_getenv(state, "CONDA_DEFAULT_ENV");
+  const char *conda_prefix = __state_getenv(state, "CONDA_PREFIX");
+  if (conda_env && conda_env[0]) {
+    snprintf(state->env_conda, sizeof(state->env_conda), "%s", conda_env);
+  }
+  if (conda_prefix && conda_prefix[0] && state->env_python_version[0] == '\0') {
+    __conda_python_version(conda_prefix, state->env_python_version, sizeof(state->env_python_version));
+  }
+  if (state->env_python_version[0]) return SUCCESS;
+
+  // pyenv's version: the shell's, the directory's or the global one
+  const char *pyenv_version = __state_getenv(state, "PYENV_VERSION");
+  const char *pyenv_root    = __state_getenv(state, "PYENV_ROOT");
+  const char *home_dir      = getenv("HOME");
+  if (pyenv_version && pyenv_version[0]) {
+    __first_word(pyenv_version, state->env_python_version, sizeof(state->env_python_version));
+    return SUCCESS;
+  }
+  char dir[PATH_MAX];
+  if (__find_cwd_markers(state, "/", MARKER_BIT(MARKER_PYTHON_VERSION), dir)) {
+    snprintf(path, sizeof(path), "%s/%s", strcmp(dir, "/") == 0 ? "" : dir, dir_markers[MARKER_PYTHON_VERSION].name);
+    text = __cached_file(&python_version_cache, path);
+  }
+  else if (pyenv_root || home_dir) {
+    if (pyenv_root) snprintf(path, sizeof(path), "%s/version", pyenv_root);
+    else            snprintf(path, sizeof(path), "%s/.pyenv/version", home_dir);
+    text = __cached_file(&python_version_cache, path);
+  }
+  else {
+    text = NULL;
+  }
+  if (text) {
+    __first_word(text, state->env_python_version, sizeof(state->env_python_version));
+    if (state->env_python_version[0]) return SUCCESS;
+  }
+
+  // the python in $PATH, by the version in its name, e.g. python3.11
+  char real_path[PATH_MAX];
+  if (__find_in_path(state, "python3", real_path) == SUCCESS) {
+    const char *name = strrchr(real_path, '/') + 1;
+    if (strncmp(name, "python", 6) == 0 && isdigit((unsigned char) name[6])) {
+      snprintf(state->env_python_version, sizeof(state->env_python_version), "%s", name + 6);
+      return SUCCESS;
+    }
+  }
+  return FAILURE;
+}
+
+/**
+ * Gather the version of node.
+ */
+int gather_node_context(struct CurrentState *state) {
+  char dir[PATH_MAX];
+  char path[PATH_MAX + sizeof("/.node-version")];
+  unsigned markers = __find_cwd_markers(state, "/",
+                                        MARKER_BIT(MARKER_NVMRC) | MARKER_BIT(MARKER_NODE_VERSION), dir);
+  if (markers) {
+    enum dir_marker marker = (markers & MARKER_BIT(MARKER_NVMRC)) ? MARKER_NVMRC : MARKER_NODE_VERSION;
+    snprintf(path, sizeof(path), "%s/%s", strcmp(dir, "/") == 0 ? "" : dir, dir_markers[marker].name);
+    const char *text = __cached_file(&nvmrc_cache, path);
+    if (text) __first_word(text, state->env_node_version, sizeof(state->env_node_version));
+    if (state->env_node_version[0]) return SUCCESS;
+  }
+
+  // the node in $PATH, e.g. .../versions/node/v20.11.0/bin/node for
+  // nvm, by the header installed with it
+  char real_path[PATH_MAX];
+  if (__find_in_path(state, "node", real_path) == SUCCESS &&
+      __node_header_version(real_path, state->env_node_version, sizeof(state->env_node_version)) == SUCCESS) {
+    return SUCCESS;
+  }
+  return FAILURE;
+}
+
+/**
+ * Gather the current kubernetes context and its namespace.
+ */
+int gather_k8s_context(struct CurrentState *state) {
+  struct KubeconfigFiles files;
+  if (__kubeconfig_files(state, &files) != SUCCESS) return FAILURE;
+
+  // read the files again only if one of them has changed
+  if (!k8s_cache.is_set || !__same_kubeconfig_files(&files, &k8s_cache.files)) {
+    char context[K8S_NAME_SIZE] = "";
+    char context_namespace[K8S_NAME_SIZE] = "";
+    for (size_t i = 0; i < files.count; i++) {
+      if (__scan_kubeconfig(files.path[i], NULL, context, sizeof(context)) == SUCCESS) break;
+    }
+    for (size_t i = 0; context[0] && i < files.count; i++) {
+      if (__scan_kubeconfig(files.path[i], context, context_namespace,
+                            sizeof(context_namespace)) == SUCCESS) break;
+    }
+
+    // the paths point into the files, so they're moved along with them
+    k8s_cache.files = files;
+    for (size_t i = 0; i < files.count; i++) {
+      k8s_cache.files.path[i] = k8s_cache.files.paths + (files.path[i] - files.paths);
+    }
+    memcpy(k8s_cache.context, context, sizeof(context));
+    memcpy(k8s_cache.context_namespace, context_namespace, sizeof(context_namespace));
+    k8s_cache.is_set = 1;
+  }
+
+  memcpy(state->k8s_context, k8s_cache.context, sizeof(state->k8s_context));
+  memcpy(state->k8s_namespace, k8s_cache.context_namespace, sizeof(state->k8s_namespace));
+  return state->k8s_context[0] ? SUCCESS : FAILURE;
+}
+
 /**
  * Generate a path relative to the root of the Git repository, using
  * '+' to represent the root
  */
 const char *get_cwd_from_gitrepo(struct CurrentState *state) {
-  if (state->head_ref == NULL) return get_cwd_from_home(state);
+  if (state->head_oid == NULL) return get_cwd_from_home(state);
 
-  static char wd[PATH_MAX];
+  char *wd = state->cwd_git_buffer;
   size_t common_length = strspn(state->repo_path, state->cwd_full);
   if (common_length == strlen(state->cwd_full)) {
     sprintf(wd, "+/");
   }
   else {
-    sprintf(wd, "+/%s", state->cwd_full + common_length + 1);
+    snprintf(wd, PATH_MAX, "+/%s", state->cwd_full + common_length + 1);
   }
   state->cwd_git_path = wd;
   return wd;
@@ -611,7 +2093,7 @@ const char *get_cwd_from_gitrepo(struct CurrentState *state) {
  * directory part with '~' if applicable
  */
 const char *get_cwd_from_home(struct CurrentState *state) {
-  static char wd[PATH_MAX];
+  char *wd = state->cwd_home_buffer;
   char *home_path = getenv("HOME");
 
   if (strncmp(state->cwd_full, home_path, strlen(home_path)) == 0) {
@@ -621,7 +2103,7 @@ const char *get_cwd_from_home(struct CurrentState *state) {
       sprintf(wd, "~");
     } else {
       // Deeper in HOME directory
-      sprintf(wd, "~%s", state->cwd_full + strlen(home_path));
+      snprintf(wd, PATH_MAX, "~%s", state->cwd_full + strlen(home_path));
     }
   } else {
     // Outside HOME directory
@@ -659,10 +2141,6 @@ char * get_cwd(struct CurrentState *state, const char *cwd_type) {
  * Memory management
  */
 void cleanup_resources(struct CurrentState *state) {
-  if (state->hostname) {
-    free((char *) state->hostname);
-  }
-
   if (state->repo_obj) {
     git_repository_free(state->repo_obj);
     state->repo_obj = NULL;
@@ -671,12 +2149,14 @@ void cleanup_resources(struct CurrentState *state) {
     free((char *) state->repo_path);
     state->repo_path = NULL;
   }
-  if (state->head_ref) {
-    git_reference_free(state->head_ref);
-    state->head_ref = NULL;
+  if (state->git_dir) {
+    free((char *) state->git_dir);
+    state->git_dir = NULL;
+  }
+  if (state->head_ref_name) {
+    free(state->head_ref_name);
+    state->head_ref_name = NULL;
   }
-
-  // context-head_oid is handled internally by libgit2. Apparently.
 
   if (state->status_list) {
     git_status_list_free(state->status_list);
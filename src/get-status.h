@@ -4,6 +4,49 @@
   header file for git-status.c
 */
 #include <git2.h>
+#include <limits.h>
+#ifdef __unix__
+#include <linux/limits.h> // For PATH_MAX
+#elif __APPLE__
+#include <sys/syslimits.h> // For PATH_MAX
+#endif
+
+#include "lazy-link.h"
+
+/**
+   Size of the buffer for the short hostname
+*/
+#define HOSTNAME_BUFFER_SIZE 256
+
+/**
+   Size of the kubernetes context and namespace, which are DNS names
+   of at most 253 characters
+*/
+#define K8S_NAME_SIZE 256
+
+/**
+   Size of the names of python environments, and of versions
+*/
+#define ENV_NAME_SIZE    256
+#define ENV_VERSION_SIZE 32
+
+/**
+   The files looked for in each directory on the way up: the project
+   markers, in the order their types are preferred when a directory
+   has more than one, then the version files of the toolchains
+*/
+enum dir_marker {
+  MARKER_PACKAGE_JSON,
+  MARKER_CARGO_TOML,
+  MARKER_GO_MOD,
+  MARKER_PYPROJECT_TOML,
+  MARKER_TERRAFORM,
+  MARKER_TOOL_VERSIONS,
+  MARKER_PYTHON_VERSION,
+  MARKER_NVMRC,
+  MARKER_NODE_VERSION,
+  MARKER_COUNT
+};
 
 
 enum aws_related_return_values {
@@ -35,10 +78,23 @@ enum git_related_return_values {
 struct CurrentState {
   // internal - probably uninteresting for user
   git_repository  *repo_obj;
-  const char      *repo_path;
-  git_reference   *head_ref;
-  const git_oid   *head_oid;
+  const char      *repo_path;      // root of the working tree
+  const char      *git_dir;
+  char            *head_ref_name;  // e.g. "refs/heads/main", or "HEAD" when detached
+  git_oid          head_id;
+  const git_oid   *head_oid;       // &head_id, or NULL in a nascent repo
   git_status_list *status_list;
+  int              status_threads; // >0: walk the working tree with this many threads
+  const char *const *environment;  // NAME=value overrides of getenv(), NULL-terminated, or NULL
+  int              record_markers;  // 1: note the dir_markers on the walk up to the repository
+  int              markers_noted;   // .. which went from cwd_full up to repo_path, or to /
+  size_t           marker_dir_length[MARKER_COUNT]; // the nearest directory with each, as a prefix of cwd_full, or 0
+  char             cwd_buffer[PATH_MAX];          // cwd_full points in here,
+  char             cwd_basename_buffer[PATH_MAX]; // cwd_basename here,
+  char             cwd_git_buffer[PATH_MAX];      // and cwd_git_path in one of
+  char             cwd_home_buffer[PATH_MAX];     // these two
+  char             hostname_buffer[HOSTNAME_BUFFER_SIZE]; // hostname points in here
+  char             project_root_buffer[PATH_MAX]; // project_name points in here
 
 
   // external - probably useful for user
@@ -59,6 +115,12 @@ struct CurrentState {
   int has_upstream;
   int conflict_num;
   int is_rebase_in_progress;
+  int is_merge_in_progress;
+  int is_cherry_pick_in_progress;
+  int is_revert_in_progress;
+  int is_bisect_in_progress;
+  char rebase_step[24];   // e.g. "3/7", or "" when not rebasing
+  const char *repo_state; // e.g. "REBASE-i" or "MERGING", as in git's own prompt
 
   int ahead_num;
   int behind_num;
@@ -69,17 +131,53 @@ struct CurrentState {
   int aws_token_is_valid; // 0 if invalid, 1 if valid, -1 if error
   int aws_token_remaining_hours;
   int aws_token_remaining_minutes;
+
+  const char *project_type; // e.g. "rust", of the nearest project marker, or ""
+  const char *project_name; // the directory the marker is in, or ""
+
+  char k8s_context[K8S_NAME_SIZE];   // the kubeconfig's current-context, or ""
+  char k8s_namespace[K8S_NAME_SIZE]; // its namespace, "default" if it has none
+
+  char env_venv[ENV_NAME_SIZE];              // the active virtualenv, or ""
+  char env_conda[ENV_NAME_SIZE];             // the active conda environment, or ""
+  char env_python_version[ENV_VERSION_SIZE]; // e.g. "3.11.4", or ""
+  char env_node_version[ENV_VERSION_SIZE];   // e.g. "20.11.0", or ""
+
+  int exit_status;         // of the last command, -1 if unknown
+  int command_duration_ms; // of the last command, -1 if unknown
 };
 
 /**
  *
- * Sets up CurrentState with default values
+ * Sets up CurrentState with default values, for the directory cwd.
+ * The state keeps no pointers to process-wide buffers, so a process
+ * can render prompts for any number of directories.
+ * @param cwd  the working directory, or NULL for the process' own
  */
-void initialise_state(struct CurrentState *state);
+void initialise_state(struct CurrentState *state, const char *cwd);
 
 
 /**
- * Gather all git-related context.
+ * Gather the git context which can be read straight from the .git
+ * directory, without libgit2: whether . is inside a git-repo, the
+ * repo and branch names, the HEAD commit, and whether a rebase,
+ * merge, cherry-pick, revert or bisect is in progress. Cheap enough
+ * to always run.
+ * @returns 0 if . is inside a git-repo, 1 otherwise
+ */
+int gather_git_head_context(struct CurrentState *state);
+
+
+/**
+ * Resolve a ref, e.g. "refs/heads/main", in the repo found by
+ * gather_git_head_context(), without libgit2.
+ * @returns SUCCESS, or FAILURE if the ref doesn't exist
+ */
+int resolve_git_ref(const struct CurrentState *state, const char *ref, git_oid *oid);
+
+
+/**
+ * Gather all git-related context. Needs libgit2 to be initialised.
  * @returns 0 if . is inside a git-repo, 1 otherwise
  */
 int gather_git_context(struct CurrentState *state);
@@ -107,6 +205,63 @@ int gather_system_context(struct CurrentState *state);
  */
 int gather_aws_context(struct CurrentState *state);
 
+/**
+ * Find the project the working directory is in, by searching upwards
+ * for a project marker: package.json, Cargo.toml, go.mod,
+ * pyproject.toml, a .terraform directory or .tool-versions. In a
+ * git-repo, the search stops at the root of the working tree.
+ *
+ * The directories up to the repository are looked in on the way to
+ * it, if record_markers is set. Under prompt2 --serve and in zsh, what
+ * each directory holds is also kept, by its inode, until it changes,
+ * so a prompt in the same tree only stats the directories.
+ *
+ * @return SUCCESS if a marker was found, FAILURE otherwise
+ */
+int gather_project_context(struct CurrentState *state);
+
+/**
+ * Gather the current kubernetes context, and its namespace, from the
+ * kubeconfig files in $KUBECONFIG, or ~/.kube/config, as kubectl
+ * would: the first current-context set wins, as does the first
+ * context of that name.
+ *
+ * Under prompt2 --serve and in zsh, the files are only read again
+ * when one of them changes, so as long as they don't, this is a stat
+ * of each. A one-shot prompt2 reads them each time.
+ *
+ * @return SUCCESS if there is a current context, FAILURE otherwise
+ */
+int gather_k8s_context(struct CurrentState *state);
+
+/**
+ * Gather the active python virtualenv or conda environment, and the
+ * version of python, without running it. The version is the first
+ * of:
+ * - the virtualenv's, from its pyvenv.cfg
+ * - the conda environment's, from its conda-meta
+ * - pyenv's: $PYENV_VERSION, the nearest .python-version, or
+ *   $PYENV_ROOT/version
+ * - the one of the python3 in $PATH, if its name says, e.g.
+ *   python3 -> python3.11
+ *
+ * Under prompt2 --serve and in zsh, the files are only read again
+ * when they change.
+ *
+ * @return SUCCESS if the version was found, FAILURE otherwise
+ */
+int gather_python_context(struct CurrentState *state);
+
+
+/**
+ * Gather the version of node, without running it: the one in the
+ * nearest .nvmrc or .node-version, or else the one of the node in
+ * $PATH, from the node_version.h installed with it.
+ *
+ * @return SUCCESS if the version was found, FAILURE otherwise
+ */
+int gather_node_context(struct CurrentState *state);
+
 /**
  * Generate a path relative to the root of the Git repository, using
  * '+' to represent the root
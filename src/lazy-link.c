@@ -0,0 +1,132 @@
+/*
+  dlopen() libgit2 and json-c on first use. See lazy-link.h.
+*/
+#ifdef LAZY_LINK
+
+#include <dlfcn.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "lazy-link.h"
+
+#ifndef LAZY_LINK_DIR
+#define LAZY_LINK_DIR "/usr/local/lib"
+#endif
+
+#define __STRINGIFY(x) #x
+#define STRINGIFY(x) __STRINGIFY(x)
+
+#ifdef __APPLE__
+#define LIB_SUFFIX ".dylib"
+#define LIB_VERSIONED(name, version) name "." version ".dylib"
+#else
+#define LIB_SUFFIX ".so"
+#define LIB_VERSIONED(name, version) name ".so." version
+#endif
+
+// The versions prompt2 was built against. Only the -dev packages have
+// the unversioned names, so those are the last resort. libgit2 has
+// been libgit2.so.<major>.<minor> since 1.0; json-c's library version
+// doesn't follow its release number: 0.13 is libjson-c.so.4, and 0.14
+// and later are libjson-c.so.5.
+#if defined(LIBGIT2_VER_MAJOR) && LIBGIT2_VER_MAJOR >= 1
+#define LIBGIT2_VERSIONED \
+  LIB_VERSIONED("libgit2", STRINGIFY(LIBGIT2_VER_MAJOR) "." STRINGIFY(LIBGIT2_VER_MINOR))
+#else
+#define LIBGIT2_VERSIONED NULL
+#endif
+
+#if defined(JSON_C_MINOR_VERSION) && (JSON_C_MAJOR_VERSION > 0 || JSON_C_MINOR_VERSION >= 14)
+#define JSON_C_VERSIONED LIB_VERSIONED("libjson-c", "5")
+#elif defined(JSON_C_MINOR_VERSION) && JSON_C_MINOR_VERSION == 13
+#define JSON_C_VERSIONED LIB_VERSIONED("libjson-c", "4")
+#else
+#define JSON_C_VERSIONED NULL
+#endif
+
+#define LAZY_DEFINE(name) __typeof__(name) *lazy_##name = NULL;
+LAZY_LIBGIT2_FUNCTIONS(LAZY_DEFINE)
+LAZY_JSON_C_FUNCTIONS(LAZY_DEFINE)
+#undef LAZY_DEFINE
+
+/**
+ * Helper: Open a library by one name, first from where it was found
+ * at build time, then wherever the dynamic linker looks for it.
+ */
+void *__open_library_named(const char *name) {
+  char path[4096];
+  snprintf(path, sizeof(path), "%s/%s", LAZY_LINK_DIR, name);
+
+  void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (handle == NULL) {
+    handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+  }
+  return handle;
+}
+
+/**
+ * Helper: Open a library by its versioned name (NULL if unknown), or
+ * failing that by its unversioned one. Warns if neither can be found.
+ */
+void *__open_library(const char *versioned, const char *unversioned) {
+  void *handle = versioned ? __open_library_named(versioned) : NULL;
+  if (handle == NULL) handle = __open_library_named(unversioned);
+  if (handle == NULL) {
+    fprintf(stderr, "prompt2: can't load %s: %s\n", versioned ? versioned : unversioned, dlerror());
+  }
+  return handle;
+}
+
+/**
+ * Helper: Look up a function, and set *loaded to 0 if it's missing
+ */
+void *__load_symbol(void *handle, const char *name, int *loaded) {
+  void *symbol = dlsym(handle, name);
+  if (symbol == NULL) {
+    fprintf(stderr, "prompt2: can't find %s: %s\n", name, dlerror());
+    *loaded = 0;
+  }
+  return symbol;
+}
+
+/**
+ * Load libgit2, unless it's already loaded.
+ */
+int lazy_load_libgit2(void) {
+  static int loaded = -1;
+  if (loaded != -1) return loaded ? SUCCESS : FAILURE;
+
+  loaded = 0;
+  void *handle = __open_library(LIBGIT2_VERSIONED, "libgit2" LIB_SUFFIX);
+  if (handle == NULL) return FAILURE;
+
+  loaded = 1;
+#define LAZY_LOAD(name) \
+  *(void **) &lazy_##name = __load_symbol(handle, #name, &loaded);
+  LAZY_LIBGIT2_FUNCTIONS(LAZY_LOAD)
+#undef LAZY_LOAD
+
+  return loaded ? SUCCESS : FAILURE;
+}
+
+/**
+ * Load json-c, unless it's already loaded.
+ */
+int lazy_load_json_c(void) {
+  static int loaded = -1;
+  if (loaded != -1) return loaded ? SUCCESS : FAILURE;
+
+  loaded = 0;
+  void *handle = __open_library(JSON_C_VERSIONED, "libjson-c" LIB_SUFFIX);
+  if (handle == NULL) return FAILURE;
+
+  loaded = 1;
+#define LAZY_LOAD(name) \
+  *(void **) &lazy_##name = __load_symbol(handle, #name, &loaded);
+  LAZY_JSON_C_FUNCTIONS(LAZY_LOAD)
+#undef LAZY_LOAD
+
+  return loaded ? SUCCESS : FAILURE;
+}
+
+#endif // LAZY_LINK
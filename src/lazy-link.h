@@ -0,0 +1,133 @@
+#ifndef LAZY_LINK_H
+#define LAZY_LINK_H
+/*
+  Optional lazy loading of libgit2 and json-c.
+
+  Built with `make LAZY_LINK=1`, prompt2 isn't linked against libgit2
+  and json-c. Instead they are dlopen()ed the first time a gatherer
+  needs them, so drawing a prompt outside a git repo (or with no
+  status widgets) doesn't pay for the dynamic linker resolving libgit2
+  and everything it depends on (OpenSSL, zlib, libssh2, ...).
+
+  Every libgit2 and json-c function prompt2 calls has to be listed
+  below: the macros make calls to them go through a function pointer
+  which lazy_load_*() fills in. In a regular build, none of this does
+  anything.
+*/
+#include "constants.h"
+
+#ifdef LAZY_LINK
+
+#include <git2.h>
+#include <json-c/json.h>
+
+#define LAZY_LIBGIT2_FUNCTIONS(X)       \
+  X(git_config_free)                    \
+  X(git_config_get_bool)                \
+  X(git_ignore_path_is_ignored)         \
+  X(git_index_entry_stage)              \
+  X(git_index_entrycount)               \
+  X(git_index_free)                     \
+  X(git_index_get_byindex)              \
+  X(git_libgit2_init)                   \
+  X(git_libgit2_shutdown)               \
+  X(git_odb_hash)                       \
+  X(git_oid_equal)                      \
+  X(git_reference_free)                 \
+  X(git_reference_lookup)               \
+  X(git_reference_target)               \
+  X(git_repository_config_snapshot)     \
+  X(git_repository_free)                \
+  X(git_repository_hashfile)            \
+  X(git_repository_index)               \
+  X(git_repository_open)                \
+  X(git_repository_path)                \
+  X(git_repository_workdir)             \
+  X(git_revwalk_free)                   \
+  X(git_revwalk_hide)                   \
+  X(git_revwalk_new)                    \
+  X(git_revwalk_next)                   \
+  X(git_revwalk_push)                   \
+  X(git_revwalk_reset)                  \
+  X(git_status_byindex)                 \
+  X(git_status_list_entrycount)         \
+  X(git_status_list_free)               \
+  X(git_status_list_new)                \
+  X(git_submodule_status)
+
+#define LAZY_JSON_C_FUNCTIONS(X)        \
+  X(json_object_get_string)             \
+  X(json_object_object_get_ex)          \
+  X(json_object_put)                    \
+  X(json_tokener_parse)
+
+#define LAZY_DECLARE(name) extern __typeof__(name) *lazy_##name;
+LAZY_LIBGIT2_FUNCTIONS(LAZY_DECLARE)
+LAZY_JSON_C_FUNCTIONS(LAZY_DECLARE)
+#undef LAZY_DECLARE
+
+#define git_config_free              (*lazy_git_config_free)
+#define git_config_get_bool          (*lazy_git_config_get_bool)
+#define git_ignore_path_is_ignored   (*lazy_git_ignore_path_is_ignored)
+#define git_index_entry_stage        (*lazy_git_index_entry_stage)
+#define git_index_entrycount         (*lazy_git_index_entrycount)
+#define git_index_free               (*lazy_git_index_free)
+#define git_index_get_byindex        (*lazy_git_index_get_byindex)
+#define git_libgit2_init             (*lazy_git_libgit2_init)
+#define git_libgit2_shutdown         (*lazy_git_libgit2_shutdown)
+#define git_odb_hash                 (*lazy_git_odb_hash)
+#define git_oid_equal                (*lazy_git_oid_equal)
+#define git_reference_free           (*lazy_git_reference_free)
+#define git_reference_lookup         (*lazy_git_reference_lookup)
+#define git_reference_target         (*lazy_git_reference_target)
+#define git_repository_config_snapshot (*lazy_git_repository_config_snapshot)
+#define git_repository_free          (*lazy_git_repository_free)
+#define git_repository_hashfile      (*lazy_git_repository_hashfile)
+#define git_repository_index         (*lazy_git_repository_index)
+#define git_repository_open          (*lazy_git_repository_open)
+#define git_repository_path          (*lazy_git_repository_path)
+#define git_repository_workdir       (*lazy_git_repository_workdir)
+#define git_revwalk_free             (*lazy_git_revwalk_free)
+#define git_revwalk_hide             (*lazy_git_revwalk_hide)
+#define git_revwalk_new              (*lazy_git_revwalk_new)
+#define git_revwalk_next             (*lazy_git_revwalk_next)
+#define git_revwalk_push             (*lazy_git_revwalk_push)
+#define git_revwalk_reset            (*lazy_git_revwalk_reset)
+#define git_status_byindex           (*lazy_git_status_byindex)
+#define git_status_list_entrycount   (*lazy_git_status_list_entrycount)
+#define git_status_list_free         (*lazy_git_status_list_free)
+#define git_status_list_new          (*lazy_git_status_list_new)
+#define git_submodule_status         (*lazy_git_submodule_status)
+
+#define json_object_get_string       (*lazy_json_object_get_string)
+#define json_object_object_get_ex    (*lazy_json_object_object_get_ex)
+#define json_object_put              (*lazy_json_object_put)
+#define json_tokener_parse           (*lazy_json_tokener_parse)
+
+
+/**
+ * Load libgit2, unless it's already loaded. Must be called before
+ * git_libgit2_init().
+ *
+ * @return SUCCESS, or FAILURE if the library or one of its functions
+ *         can't be found
+ */
+int lazy_load_libgit2(void);
+
+/**
+ * Load json-c, unless it's already loaded.
+ *
+ * @return SUCCESS, or FAILURE if the library or one of its functions
+ *         can't be found
+ */
+int lazy_load_json_c(void);
+
+#else
+
+// Linked the regular way: always loaded
+#define lazy_load_libgit2() SUCCESS
+#define lazy_load_json_c()  SUCCESS
+
+#endif // LAZY_LINK
+
+#endif // LAZY_LINK_H
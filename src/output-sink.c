@@ -0,0 +1,74 @@
+#include <errno.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "constants.h"
+#include "output-sink.h"
+
+
+/**
+ * A sink that writes to a file descriptor.
+ */
+struct OutputSink sink_to_fd(int fd, int nul_terminated) {
+  struct OutputSink sink = { .fd = fd, .nul_terminated = nul_terminated };
+  return sink;
+}
+
+
+/**
+ * A sink that copies into buffer.
+ */
+struct OutputSink sink_to_buffer(char *buffer, size_t buffer_size) {
+  struct OutputSink sink = { .fd = -1, .buffer = buffer, .buffer_size = buffer_size };
+  if (buffer_size > 0) buffer[0] = '\0';
+  return sink;
+}
+
+
+/**
+ * Helper: Write all of the iovecs, with as few system calls as the
+ * kernel allows.
+ */
+int __write_all(int fd, struct iovec *iov, int iovcnt) {
+  while (iovcnt > 0) {
+    ssize_t written = writev(fd, iov, iovcnt);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return FAILURE;
+    }
+
+    // skip past what was written
+    while (iovcnt > 0 && (size_t) written >= iov->iov_len) {
+      written -= iov->iov_len;
+      iov++;
+      iovcnt--;
+    }
+    if (iovcnt > 0) {
+      iov->iov_base = (char *) iov->iov_base + written;
+      iov->iov_len -= written;
+    }
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * Put the output in the sink.
+ */
+int sink_emit(struct OutputSink *sink, const char *bytes, size_t length) {
+  if (sink->fd >= 0) {
+    struct iovec iov[2] = {
+      { .iov_base = (void *) bytes, .iov_len = length },
+      { .iov_base = "",             .iov_len = 1 },
+    };
+    return __write_all(sink->fd, iov, sink->nul_terminated ? 2 : 1);
+  }
+
+  if (sink->buffer_size == 0) return FAILURE;
+  int fits = length < sink->buffer_size;
+  sink->length = fits ? length : sink->buffer_size - 1;
+  memcpy(sink->buffer, bytes, sink->length);
+  sink->buffer[sink->length] = '\0';
+  return fits ? SUCCESS : FAILURE;
+}
@@ -0,0 +1,48 @@
+#ifndef OUTPUTSINK_H
+#define OUTPUTSINK_H
+/*
+  header file for output-sink.c
+*/
+#include <stddef.h>
+
+
+/**
+ * Where a rendered prompt goes: straight to a file descriptor, with
+ * a single write, or into a buffer of the caller's (for the zsh
+ * module). Either way there is no stdio buffering and no copy of the
+ * prompt on the way.
+ */
+struct OutputSink {
+  int    fd;             // write to this file descriptor, if >= 0
+  int    nul_terminated; // fd: follow each output with a NUL (for --serve)
+
+  char  *buffer;         // otherwise copy the output (and a NUL) here
+  size_t buffer_size;
+  size_t length;         // of the output in the buffer
+};
+
+
+/**
+ * A sink that writes to a file descriptor.
+ */
+struct OutputSink sink_to_fd(int fd, int nul_terminated);
+
+
+/**
+ * A sink that copies into buffer, as a NUL-terminated string.
+ */
+struct OutputSink sink_to_buffer(char *buffer, size_t buffer_size);
+
+
+/**
+ * Put the output in the sink: a file descriptor gets it with one
+ * write(2) (a writev(2) with the NUL), unless the kernel takes only
+ * part of it; a buffer gets it replacing what was there.
+ *
+ * @return SUCCESS, or FAILURE if it couldn't all be written, or
+ *         didn't fit the buffer (which then holds as much as fits)
+ */
+int sink_emit(struct OutputSink *sink, const char *bytes, size_t length);
+
+
+#endif //OUTPUTSINK_H
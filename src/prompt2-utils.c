@@ -7,12 +7,17 @@
 
 #include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <uthash.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "constants.h"
+#include "display-width.h"
 #include "prompt2-utils.h"
 
 
@@ -131,15 +136,24 @@ int safe_strcat(char *target_string, const char *addition, int max_len) {
  * width and replaces the last three characters with '...'. If the
  * string is shorter than or equal to the maximum width, it remains
  * unchanged.
+ * Widths are in terminal columns, and code points are never split.
  *
  * @param str       The string to truncate. Must be null-terminated.
  * @param max_width The maximum allowed width of the string,
  *                  including the ellipsis.
  */
 void truncate_with_ellipsis(char *str, size_t max_width) {
-  if (str && strlen(str) > max_width) {
-    strcpy(&str[max_width - 3], "...");
+  if (str == NULL) return;
+
+  size_t length = strlen(str);
+  if ((size_t) display_width(str, length) <= max_width) return;
+  if (max_width < 3) {
+    // only room for part of the ellipsis
+    memset(str, '.', max_width);
+    str[max_width] = '\0';
+    return;
   }
+  strcpy(&str[display_prefix(str, length, max_width - 3)], "...");
 }
 
 
@@ -253,27 +267,11 @@ char* replace_literal_newlines(const char* input) {
  * @return SUCCESS  if non-expanding tokens are found, FAILURE otherwise.
  */
 int has_nonexpanding_tokens(const char *str) {
-  // two types of expanding widget tokens:
-  // - CWD
-  // - SPC
-  const int token_len = 5;
-  
-  const char *start;
-  const char *end;
-  while ((start = strstr(str, "@{")) != NULL) {
-    end = strchr(start + 2, '}');
-    if (end == NULL) {
-      break;
-    }
-    if ((end != start + token_len) ||
-        (strncmp(start + 2, "CWD", 3) != 0
-          &&
-        strncmp(start + 2, "SPC", 3) != 0)) {
-      return SUCCESS;
-    }
-    str = end + 1;
-  }
-  return FAILURE;
+  struct PromptMarkers scan;
+  scan_prompt_markers(str, &scan);
+  int result = has_nonexpanding_tokens_scanned(&scan);
+  free_prompt_markers(&scan);
+  return result;
 }
 
 
@@ -309,6 +307,7 @@ void remove_widget_token(char *str, const char *token) {
  * This function shortens the input path to the specified maximum
  * width and prepends an ellipsis ('...'). If the path is shorter than
  * or equal to the maximum width, it remains unchanged.
+ * Widths are in terminal columns, and code points are never split.
  *
  * @param original_path The filesystem path to shorten. Must be
  *                      null-terminated.
@@ -318,31 +317,20 @@ void remove_widget_token(char *str, const char *token) {
 void shorten_path(char *original_path, int max_width) {
 
   // Sanity checks
-  int original_path_len = strlen(original_path);
-  if (original_path_len <= max_width) return;
+  size_t original_path_len = strlen(original_path);
+  if (display_width(original_path, original_path_len) <= max_width) return;
   if (max_width < 3) {
-    for (int i = 0; i < max_width; i++) original_path[i] = '.';
-    original_path[3] = '\0';
+    // only room for part of the ellipsis
+    int dots = max_width > 0 ? max_width : 0;
+    memset(original_path, '.', dots);
+    original_path[dots] = '\0';
     return;
   }
 
-  // How much to shrink?
-  int shrinkage = original_path_len - max_width;
-  if (shrinkage <= 3) {
-    shrinkage = 3; // for the ellipsis
-  }
-  else {
-    shrinkage += 3;
-  }
-
-  // Shrink it
-  char rebuild_path[original_path_len + 1];
-  strcpy(rebuild_path, "...");
-  strncat(rebuild_path,
-          original_path + shrinkage,     // forward shrinkage chars
-          original_path_len - shrinkage); // copy this many chars
-
-  strcpy(original_path, rebuild_path);
+  // Keep as much of the end of the path as fits after the ellipsis
+  size_t keep_from = display_suffix(original_path, original_path_len, max_width - 3);
+  memmove(original_path + 3, original_path + keep_from, original_path_len - keep_from + 1);
+  memcpy(original_path, "...", 3);
 }
 
 
@@ -359,50 +347,244 @@ void shorten_path(char *original_path, int max_width) {
  *                 otherwise.
  */
 int are_escape_sequences_properly_formed(const char *mystring) {
+  struct PromptMarkers scan;
+  scan_prompt_markers(mystring, &scan);
+  int result = are_escape_sequences_properly_formed_scanned(&scan);
+  free_prompt_markers(&scan);
+  return result;
+}
+
+
+/**
+ * Counts the number of visible (non-escape sequence) characters in a
+ * string, in terminal columns.
+ *
+ * This function iterates through the input string and counts
+ * characters that are not part of escape sequences, widget or
+ * attribute tokens, providing the total number of visible characters.
+ * Wide characters, such as emoji, count for two; combining marks for
+ * none.
+ *
+ * @param mystring The input string to count visible characters in.
+ * @return The number of visible characters in the input string.
+ */
+int count_visible_chars(const char *mystring) {
+  struct PromptMarkers scan;
+  scan_prompt_markers(mystring, &scan);
+  int result = count_visible_chars_scanned(&scan);
+  free_prompt_markers(&scan);
+  return result;
+}
+
+ 
+/* ========================================================
+   Scanning prompts for markers
+   ======================================================== */
+
+/**
+ * Helper: Record a marker, moving the markers to the heap when
+ * there are more than fit in the scan itself
+ */
+void __add_marker(struct PromptMarkers *scan, enum marker_type type, size_t offset) {
+  if (scan->count == scan->capacity) {
+    size_t capacity = scan->capacity * 2;
+    struct PromptMarker *markers;
+    if (scan->markers == scan->local) {
+      markers = malloc(capacity * sizeof(struct PromptMarker));
+      if (markers) memcpy(markers, scan->local, sizeof(scan->local));
+    }
+    else {
+      markers = realloc(scan->markers, capacity * sizeof(struct PromptMarker));
+    }
+    if (!markers) return;
+    scan->markers = markers;
+    scan->capacity = capacity;
+  }
+  scan->markers[scan->count].type = type;
+  scan->markers[scan->count].offset = offset;
+  scan->count++;
+}
+
+/**
+ * Helper: Record the marker (if any) which starts at offset, where
+ * there's a '@', '%', '}' or '\'
+ */
+void __check_marker(struct PromptMarkers *scan, size_t offset) {
+  const char *ptr = scan->str + offset;
+  switch (*ptr) {
+  case '@':
+    if (*(ptr + 1) == '{') __add_marker(scan, MARKER_WIDGET, offset);
+    break;
+  case '%':
+    if (*(ptr + 1) == '{') __add_marker(scan, MARKER_ATTRIBUTE, offset);
+    break;
+  case '}':
+    __add_marker(scan, MARKER_CLOSE, offset);
+    break;
+  case '\\':
+    if      (*(ptr + 1) == '[') __add_marker(scan, MARKER_BRACKET_OPEN, offset);
+    else if (*(ptr + 1) == ']') __add_marker(scan, MARKER_BRACKET_CLOSE, offset);
+    else if (*(ptr + 1) == 'e' ||
+             (*(ptr + 1) == '0' && *(ptr + 2) == '3' && *(ptr + 3) == '3')) {
+      __add_marker(scan, MARKER_ESCAPE, offset);
+    }
+    break;
+  }
+}
+
+
+/**
+ * Find every marker in a prompt.
+ */
+void scan_prompt_markers(const char *str, struct PromptMarkers *scan) {
+  scan->str      = str;
+  scan->length   = strlen(str);
+  scan->count    = 0;
+  scan->capacity = PROMPT_MARKERS_LOCAL;
+  scan->markers  = scan->local;
+
+  size_t i = 0;
+#ifdef __SSE2__
+  // Every marker starts with one of these
+  const __m128i at        = _mm_set1_epi8('@');
+  const __m128i percent   = _mm_set1_epi8('%');
+  const __m128i close     = _mm_set1_epi8('}');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  for (; i + 16 <= scan->length; i += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *) (str + i));
+    __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, at),
+                                             _mm_cmpeq_epi8(chunk, percent)),
+                                _mm_or_si128(_mm_cmpeq_epi8(chunk, close),
+                                             _mm_cmpeq_epi8(chunk, backslash)));
+    unsigned int mask = _mm_movemask_epi8(hits);
+    while (mask) {
+      __check_marker(scan, i + __builtin_ctz(mask));
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for (; i < scan->length; i++) {
+    char c = str[i];
+    if (c == '@' || c == '%' || c == '}' || c == '\\') __check_marker(scan, i);
+  }
+}
+
+
+/**
+ * Free what scan_prompt_markers() allocated, if anything.
+ */
+void free_prompt_markers(struct PromptMarkers *scan) {
+  if (scan->markers != scan->local) free(scan->markers);
+  scan->markers = scan->local;
+  scan->count = 0;
+}
+
+
+/**
+ * has_nonexpanding_tokens() for a scanned prompt.
+ */
+int has_nonexpanding_tokens_scanned(const struct PromptMarkers *scan) {
+  // two types of expanding widget tokens:
+  // - CWD
+  // - SPC
+  const size_t token_len = 5;
+
+  size_t resume = 0; // tokens are looked for from here on
+  for (size_t i = 0; i < scan->count; i++) {
+    if (scan->markers[i].type != MARKER_WIDGET || scan->markers[i].offset < resume) continue;
+
+    // the first } after the @{
+    size_t j = i + 1;
+    while (j < scan->count && scan->markers[j].type != MARKER_CLOSE) j++;
+    if (j == scan->count) break;
+
+    size_t start = scan->markers[i].offset;
+    size_t end   = scan->markers[j].offset;
+    if ((end != start + token_len) ||
+        (strncmp(scan->str + start + 2, "CWD", 3) != 0
+          &&
+        strncmp(scan->str + start + 2, "SPC", 3) != 0)) {
+      return SUCCESS;
+    }
+    resume = end + 1;
+    i = j;
+  }
+  return FAILURE;
+}
+
+
+/**
+ * Checks if a scanned prompt contains the widget token.
+ */
+int has_widget_token_scanned(const struct PromptMarkers *scan, const char *name) {
+  size_t name_len = strlen(name);
+  for (size_t i = 0; i < scan->count; i++) {
+    if (scan->markers[i].type != MARKER_WIDGET) continue;
+    const char *wtoken = scan->str + scan->markers[i].offset + 2;
+    if (strncmp(wtoken, name, name_len) == 0 && wtoken[name_len] == '}') {
+      return SUCCESS;
+    }
+  }
+  return FAILURE;
+}
+
+
+/**
+ * are_escape_sequences_properly_formed() for a scanned prompt.
+ */
+int are_escape_sequences_properly_formed_scanned(const struct PromptMarkers *scan) {
   int in_escape_sequence = 0;
   int in_bracket_sequence = 0;
+  size_t position = 0; // everything before here has been checked
+
+  for (size_t i = 0; i <= scan->count; i++) {
+    const struct PromptMarker *marker = (i < scan->count) ? &scan->markers[i] : NULL;
+    size_t offset = marker ? marker->offset : scan->length;
+    if (marker && (marker->type == MARKER_WIDGET ||
+                   marker->type == MARKER_ATTRIBUTE ||
+                   marker->type == MARKER_CLOSE)) continue;
+    if (offset < position) continue; // skipped as part of an escape sequence
+
+    // Found m - which should close an escape sequence
+    if (in_escape_sequence && memchr(scan->str + position, 'm', offset - position)) {
+      if (!in_bracket_sequence) {
+        fprintf(stderr, "Improperly formed - found closing of escape sequence outside of brackets\n");
+        return ERROR;
+      }
+      in_escape_sequence = 0;
+    }
+    if (!marker) break;
 
-  while (*mystring) {
-
-    // first two conditionals to deal with opening and closing brackets
-    if (*mystring == '\\' && *(mystring + 1) == '[') {
+    switch (marker->type) {
+    case MARKER_BRACKET_OPEN:
       // Found \[
       if (in_bracket_sequence) {
         fprintf(stderr, "Improperly formed - found a new opening bracket before closing the previous one\n");
         return ERROR;
       }
       in_bracket_sequence = 1;
-      mystring++; // Skip the next character as it is part of the escape sequence
-    } else if (*mystring == '\\' && *(mystring + 1) == ']') {
+      position = offset + 2;
+      break;
+    case MARKER_BRACKET_CLOSE:
       // Found \]
       if (!in_bracket_sequence) {
         fprintf(stderr, "Improperly formed - found a closing bracket without a matching opening bracket\n");
         return ERROR;
       }
       in_bracket_sequence = 0;
-      mystring++; // Skip the next character as it is part of the escape sequence
-    }
-
-    // Remaining conditionals to deal with escape sequences
-    else if (*mystring == '\\' &&
-             ((*(mystring + 1) == '0' && *(mystring + 2) == '3' && *(mystring + 3) == '3') ||
-              *(mystring + 1) == 'e')) {
+      position = offset + 2;
+      break;
+    default:
       // Found \033 or \e, which should be within brackets
       if (!in_bracket_sequence) {
         fprintf(stderr, "Improperly formed - found an escape sequence outside of brackets\n");
         return ERROR;
       }
       in_escape_sequence = 1;
-      mystring += (*mystring + 1 == 'e') ? 1 : 3; // Skip the next characters as they are part of the escape sequence
-    } else if (*mystring == 'm' && in_escape_sequence) {
-      // Found m - which should close an escape sequence
-      if (!in_bracket_sequence) {
-        fprintf(stderr, "Improperly formed - found closing of escape sequence outside of brackets\n");
-        return ERROR;
-      }
-      in_escape_sequence = 0;
+      position = offset + 4; // the characters of the escape sequence are skipped
+      if (position > scan->length) position = scan->length;
+      break;
     }
-    mystring++;
   }
 
   // If we're still in an escape sequence or in a bracket sequence at the end, it's improperly formed
@@ -411,50 +593,102 @@ int are_escape_sequences_properly_formed(const char *mystring) {
 
 
 /**
- * Counts the number of visible (non-escape sequence) characters in a
- * string.
- *
- * This function iterates through the input string and counts
- * characters that are not part of escape sequences, widget or
- * attribute tokens, providing the total number of visible characters.
- *
- * @param mystring The input string to count visible characters in.
- * @return The number of visible characters in the input string.
+ * count_visible_chars() for a scanned prompt.
  */
-int count_visible_chars(const char *mystring) {
+int count_visible_chars_scanned(const struct PromptMarkers *scan) {
   int real_chars = 0;
   int in_bracket_sequence = 0;
   int in_token = 0; // for both widget and style attribute tokens
-  while (*mystring) {
-    if (!in_token && *mystring == '\\' && *(mystring + 1) == '[') {
+  size_t visible = 0; // start of the current run of visible characters
+
+  for (size_t i = 0; i < scan->count; i++) {
+    size_t offset = scan->markers[i].offset;
+    int was_visible = !in_bracket_sequence && !in_token;
+
+    switch (scan->markers[i].type) {
+    case MARKER_BRACKET_OPEN:
       // Found the start of a bracketed sequence
-      in_bracket_sequence = 1;
-      mystring++; // Skip the '[' character
-    } else if (in_bracket_sequence && *mystring == '\\' && *(mystring + 1) == ']') {
+      if (!in_token) in_bracket_sequence = 1;
+      break;
+    case MARKER_BRACKET_CLOSE:
       // Found the end of a bracketed sequence
-      in_bracket_sequence = 0;
-      mystring++; // Skip the ']' character
-    } else if (!in_bracket_sequence && ( *mystring == '@' || *mystring == '%') && *(mystring + 1) == '{') {
+      if (in_bracket_sequence) {
+        in_bracket_sequence = 0;
+        visible = offset + 2;
+      }
+      break;
+    case MARKER_WIDGET:
+    case MARKER_ATTRIBUTE:
       // Found the start of a widget or attribute token
-      in_token = 1;
-    } else if (in_token && *mystring == '}') {
+      if (!in_bracket_sequence) in_token = 1;
+      break;
+    case MARKER_CLOSE:
       // Found the end of a widget token
-      in_token = 0;
-    } else if (!in_bracket_sequence && !in_token) {
-      // Count the character if it's not within a bracketed sequence or a widget token
-      real_chars++;
+      if (in_token) {
+        in_token = 0;
+        visible = offset + 1;
+      }
+      break;
+    default:
+      break;
     }
-    mystring++;
+
+    // Visible characters are counted a run at a time, in columns
+    if (was_visible && (in_bracket_sequence || in_token)) {
+      real_chars += display_width(scan->str + visible, offset - visible);
+    }
+  }
+  if (!in_bracket_sequence && !in_token) {
+    real_chars += display_width(scan->str + visible, scan->length - visible);
   }
 
   return real_chars;
 }
 
- 
+
 /* ========================================================
    Other resources
    ======================================================== */
 
+/**
+ * Parses an $EPOCHREALTIME timestamp into microseconds.
+ */
+int64_t parse_epoch_realtime(const char *text, const char **end) {
+  int64_t seconds = 0, fraction = 0;
+  const char *p = text;
+  if (!isdigit((unsigned char) *p)) return 0;
+  while (isdigit((unsigned char) *p)) seconds = seconds * 10 + (*p++ - '0');
+
+  int digits = 0;
+  if ((*p == '.' || *p == ',') && isdigit((unsigned char) p[1])) {
+    for (p++; isdigit((unsigned char) *p); p++) {
+      if (digits < 6) {
+        fraction = fraction * 10 + (*p - '0');
+        digits++;
+      }
+    }
+  }
+  for (; digits < 6; digits++) fraction *= 10;
+
+  if (end) *end = p;
+  return seconds * 1000000 + fraction;
+}
+
+
+/**
+ * Formats a duration with its two largest units.
+ */
+void format_duration(int64_t milliseconds, char *buffer, size_t size) {
+  int64_t seconds = milliseconds / 1000;
+  if (milliseconds < 1000)    snprintf(buffer, size, "%dms", (int) (milliseconds > 0 ? milliseconds : 0));
+  else if (seconds < 60)      snprintf(buffer, size, "%ds", (int) seconds);
+  else if (seconds < 3600)    snprintf(buffer, size, "%dm%ds", (int) (seconds / 60), (int) (seconds % 60));
+  else if (seconds < 86400)   snprintf(buffer, size, "%dh%dm", (int) (seconds / 3600), (int) (seconds % 3600 / 60));
+  else                        snprintf(buffer, size, "%lldd%dh", (long long) (seconds / 86400),
+                                       (int) (seconds % 86400 / 3600));
+}
+
+
 /**
  * Gets the width of the terminal.
  *
@@ -1,6 +1,8 @@
 #ifndef PROMPT2_UTILS_H
 #define PROMPT2_UTILS_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <uthash.h>
 
 
@@ -66,6 +68,7 @@ int safe_strcat(char *target_string, const char *addition, int max_len);
  * width and replaces the last three characters with '...'. If the
  * string is shorter than or equal to the maximum width, it remains
  * unchanged.
+ * Widths are in terminal columns, and code points are never split.
  *
  * @param str       The string to truncate. Must be null-terminated.
  * @param max_width The maximum allowed width of the string,
@@ -98,6 +101,8 @@ char *escape_ini_backslashes(const char *input);
 char* replace_literal_newlines(const char* input);
 
 
+
+
 /**
  * Checks if a string contains any non-expanding widget tokens.
  *
@@ -136,6 +141,7 @@ void remove_widget_token(char *str, const char *token);
  * This function shortens the input path to the specified maximum
  * width and prepends an ellipsis ('...'). If the path is shorter than
  * or equal to the maximum width, it remains unchanged.
+ * Widths are in terminal columns, and code points are never split.
  *
  * @param original_path The filesystem path to shorten. Must be
  *                      null-terminated.
@@ -162,11 +168,13 @@ int are_escape_sequences_properly_formed(const char *mystring);
 
 /**
  * Counts the number of visible (non-escape sequence) characters in a
- * string.
+ * string, in terminal columns.
  *
  * This function iterates through the input string and counts
  * characters that are not part of escape sequences or widget tokens,
  * providing the total number of visible characters.
+ * Wide characters, such as emoji, count for two; combining marks for
+ * none.
  *
  * @param mystring The input string to count visible characters in.
  * @return The number of visible characters in the input string.
@@ -174,10 +182,115 @@ int are_escape_sequences_properly_formed(const char *mystring);
 int count_visible_chars(const char *mystring);
 
 
+/* ========================================================
+   Scanning prompts for markers
+   ======================================================== */
+
+/**
+ * The markers which the functions below (and parse_prompt() and
+ * replace_attribute_tokens()) look for in a prompt.
+ */
+enum marker_type {
+  MARKER_WIDGET = 0,    // @{
+  MARKER_ATTRIBUTE,     // %{
+  MARKER_CLOSE,         // }
+  MARKER_BRACKET_OPEN,  // \[
+  MARKER_BRACKET_CLOSE, // \]
+  MARKER_ESCAPE,        // \e or \033
+};
+
+struct PromptMarker {
+  enum marker_type type;
+  size_t           offset; // in the prompt
+};
+
+/**
+   Markers kept in PromptMarkers itself, before they go on the heap
+*/
+#define PROMPT_MARKERS_LOCAL 64
+
+/**
+ * Every marker in a prompt, in order, from one pass over it.
+ */
+struct PromptMarkers {
+  const char          *str;
+  size_t               length;
+  size_t               count;
+  size_t               capacity;
+  struct PromptMarker *markers; // local, or on the heap if there are many
+  struct PromptMarker  local[PROMPT_MARKERS_LOCAL];
+};
+
+
+/**
+ * Find every marker in a prompt. Literal text between markers is
+ * skipped 16 bytes at a time where SSE2 is available.
+ *
+ * @param str     The prompt. It must outlive the scan.
+ * @param scan    Set to the markers. Free with free_prompt_markers().
+ */
+void scan_prompt_markers(const char *str, struct PromptMarkers *scan);
+
+
+/**
+ * Free what scan_prompt_markers() allocated, if anything.
+ */
+void free_prompt_markers(struct PromptMarkers *scan);
+
+
+/**
+ * has_nonexpanding_tokens() for a scanned prompt.
+ */
+int has_nonexpanding_tokens_scanned(const struct PromptMarkers *scan);
+
+
+/**
+ * Checks if a scanned prompt contains the widget token, e.g. "CWD"
+ * for @{CWD}. Case sensitive.
+ * @return SUCCESS if it does, FAILURE otherwise.
+ */
+int has_widget_token_scanned(const struct PromptMarkers *scan, const char *name);
+
+
+/**
+ * are_escape_sequences_properly_formed() for a scanned prompt.
+ */
+int are_escape_sequences_properly_formed_scanned(const struct PromptMarkers *scan);
+
+
+/**
+ * count_visible_chars() for a scanned prompt.
+ */
+int count_visible_chars_scanned(const struct PromptMarkers *scan);
+
+
 /* ========================================================
    Resources for manipulating strings
    ======================================================== */
 
+/**
+ * Parses a timestamp as bash and zsh give it in $EPOCHREALTIME: the
+ * seconds since the epoch, with or without a fraction (after a '.',
+ * or a ',' in some locales).
+ *
+ * @param text The timestamp, e.g. "1718000000.123456".
+ * @param end  Set to just after the timestamp, unless NULL.
+ * @return the timestamp in microseconds, or 0 if text doesn't start
+ *         with one
+ */
+int64_t parse_epoch_realtime(const char *text, const char **end);
+
+
+/**
+ * Formats a duration with its two largest units, e.g. "850ms", "42s",
+ * "1m23s", "2h5m" or "3d4h".
+ *
+ * @param milliseconds The duration.
+ * @param buffer       Set to the formatted duration.
+ */
+void format_duration(int64_t milliseconds, char *buffer, size_t size);
+
+
 /**
  * Gets the width of the terminal.
  *
@@ -0,0 +1,209 @@
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
+#endif
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef __unix__
+#include <linux/limits.h> // For PATH_MAX
+#elif __APPLE__
+#include <sys/syslimits.h> // For PATH_MAX
+#endif
+#include <unistd.h>
+
+#include "constants.h"
+#include "render-cache.h"
+
+/*
+  Memoization of rendered prompts.
+
+  When nothing the prompt is rendered from has changed - the
+  configuration, the directory, the terminal width and the gathered
+  state - the rendered prompt is byte for byte the same as last time.
+  render_prompt() fingerprints all of these after gathering, and on a
+  hit skips formatting the widgets and laying out the lines.
+
+  Long-lived prompt2s (--serve, the zsh module) keep the last prompt
+  in memory. One-shot prompt2s can use a small file in
+  $XDG_RUNTIME_DIR with a few slots, picked by fingerprint. A slot is
+  read and written with one pread()/pwrite() and carries a checksum,
+  so a slot torn by two shells writing it at once is just a miss.
+*/
+
+#define RENDER_CACHE_FILE       "prompt2-render.cache"
+#define RENDER_CACHE_SLOTS      16
+#define RENDER_CACHE_PROMPT_LEN 4096 // longer prompts aren't cached in the file
+
+struct RenderCacheSlot {
+  uint64_t fingerprint;
+  uint64_t checksum; // of the fingerprint, length and prompt
+  uint32_t length;
+  char     prompt[RENDER_CACHE_PROMPT_LEN];
+};
+
+/**
+   The prompt kept in memory
+*/
+static uint64_t memo_fingerprint = 0;
+static char    *memo_prompt      = NULL;
+static size_t   memo_length      = 0;
+
+
+/**
+ * Fold some bytes into an FNV-1a fingerprint.
+ */
+uint64_t fingerprint_bytes(uint64_t fingerprint, const void *bytes, size_t length) {
+  const unsigned char *p = bytes;
+  for (size_t i = 0; i < length; i++) {
+    fingerprint ^= p[i];
+    fingerprint *= 1099511628211ull;
+  }
+  return fingerprint;
+}
+
+/**
+ * Fold a string, including its terminating NUL, into a fingerprint.
+ */
+uint64_t fingerprint_string(uint64_t fingerprint, const char *str) {
+  if (str == NULL) str = "";
+  return fingerprint_bytes(fingerprint, str, strlen(str) + 1);
+}
+
+/**
+ * Fold a number into a fingerprint.
+ */
+uint64_t fingerprint_int(uint64_t fingerprint, int64_t number) {
+  return fingerprint_bytes(fingerprint, &number, sizeof(number));
+}
+
+
+/**
+ * Helper: Checksum of a slot
+ */
+uint64_t __slot_checksum(const struct RenderCacheSlot *slot) {
+  uint64_t checksum = fingerprint_int(FINGERPRINT_INIT, (int64_t) slot->fingerprint);
+  checksum = fingerprint_int(checksum, slot->length);
+  return fingerprint_bytes(checksum, slot->prompt, slot->length);
+}
+
+/**
+ * Helper: Open the cache file, creating it if needed.
+ * @return a file descriptor, or -1 if there is no usable cache
+ */
+int __open_render_cache_file(void) {
+  const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+  if (runtime_dir == NULL || runtime_dir[0] == '\0') return -1;
+
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/%s", runtime_dir, RENDER_CACHE_FILE);
+
+  int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0600);
+  if (fd < 0) return -1;
+
+  // Only trust a file of our own
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_uid != getuid()) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * Helper: Offset of the slot for a fingerprint in the cache file
+ */
+off_t __slot_offset(uint64_t fingerprint) {
+  return (off_t) (fingerprint % RENDER_CACHE_SLOTS) * (off_t) sizeof(struct RenderCacheSlot);
+}
+
+/**
+ * Helper: Keep a copy of the prompt in memory
+ */
+void __memoize(uint64_t fingerprint, const char *prompt, size_t length) {
+  char *copy = malloc(length + 1);
+  if (!copy) return;
+  memcpy(copy, prompt, length);
+  copy[length] = '\0';
+  free(memo_prompt);
+  memo_prompt      = copy;
+  memo_length      = length;
+  memo_fingerprint = fingerprint;
+}
+
+
+/**
+ * Look up the prompt rendered for a fingerprint.
+ */
+int render_cache_load(uint64_t fingerprint, int use_file, const char **prompt, size_t *length) {
+  if (memo_prompt && memo_fingerprint == fingerprint) {
+    *prompt = memo_prompt;
+    *length = memo_length;
+    return SUCCESS;
+  }
+  if (!use_file) return FAILURE;
+
+  int fd = __open_render_cache_file();
+  if (fd < 0) return FAILURE;
+
+  struct RenderCacheSlot slot;
+  ssize_t got = pread(fd, &slot, sizeof(slot), __slot_offset(fingerprint));
+  close(fd);
+
+  size_t header = offsetof(struct RenderCacheSlot, prompt);
+  if (got < (ssize_t) header ||
+      slot.fingerprint != fingerprint ||
+      slot.length >= RENDER_CACHE_PROMPT_LEN ||
+      (size_t) got < header + slot.length ||
+      slot.checksum != __slot_checksum(&slot)) {
+    return FAILURE;
+  }
+
+  __memoize(fingerprint, slot.prompt, slot.length);
+  if (memo_fingerprint != fingerprint) return FAILURE; // out of memory
+  *prompt = memo_prompt;
+  *length = memo_length;
+  return SUCCESS;
+}
+
+
+/**
+ * Keep the prompt rendered for a fingerprint.
+ */
+int render_cache_store(uint64_t fingerprint, int use_file, const char *prompt, size_t length) {
+  __memoize(fingerprint, prompt, length);
+  if (!use_file) return SUCCESS;
+
+  if (length >= RENDER_CACHE_PROMPT_LEN) return FAILURE;
+
+  int fd = __open_render_cache_file();
+  if (fd < 0) return FAILURE;
+
+  struct RenderCacheSlot slot;
+  slot.fingerprint = fingerprint;
+  slot.length      = (uint32_t) length;
+  memcpy(slot.prompt, prompt, length);
+  slot.checksum    = __slot_checksum(&slot);
+
+  size_t size = offsetof(struct RenderCacheSlot, prompt) + length;
+  ssize_t written = pwrite(fd, &slot, size, __slot_offset(fingerprint));
+  close(fd);
+  return written == (ssize_t) size ? SUCCESS : FAILURE;
+}
+
+
+/**
+ * Forget the prompt kept in memory.
+ */
+void render_cache_clear(void) {
+  free(memo_prompt);
+  memo_prompt      = NULL;
+  memo_length      = 0;
+  memo_fingerprint = 0;
+}
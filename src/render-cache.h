@@ -0,0 +1,69 @@
+#ifndef RENDERCACHE_H
+#define RENDERCACHE_H
+/*
+  header file for render-cache.c
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+   Starting value of an FNV-1a fingerprint
+*/
+#define FINGERPRINT_INIT 14695981039346656037ull
+
+
+/**
+ * Fold some bytes into an FNV-1a fingerprint.
+ * @return the new fingerprint
+ */
+uint64_t fingerprint_bytes(uint64_t fingerprint, const void *bytes, size_t length);
+
+
+/**
+ * Fold a string, including its terminating NUL (so that "ab","c"
+ * and "a","bc" differ), into an FNV-1a fingerprint. NULL is folded
+ * in as the empty string.
+ * @return the new fingerprint
+ */
+uint64_t fingerprint_string(uint64_t fingerprint, const char *str);
+
+
+/**
+ * Fold a number into an FNV-1a fingerprint.
+ * @return the new fingerprint
+ */
+uint64_t fingerprint_int(uint64_t fingerprint, int64_t number);
+
+
+/**
+ * Look up the prompt rendered for a fingerprint of everything it was
+ * rendered from: first the one kept in memory by this process, then,
+ * if use_file is set, the render cache file shared by all prompt2
+ * processes of the user.
+ *
+ * @param prompt  Set to the prompt on a hit. It stays valid until
+ *                the next render_cache_store() or render_cache_clear().
+ * @param length  Set to the length of the prompt, which may have NULs
+ *                in it (such as the one before a right prompt).
+ * @return SUCCESS on a cache hit, FAILURE otherwise
+ */
+int render_cache_load(uint64_t fingerprint, int use_file, const char **prompt, size_t *length);
+
+
+/**
+ * Keep the prompt rendered for a fingerprint in memory and, if
+ * use_file is set, in the render cache file.
+ *
+ * @return SUCCESS, or FAILURE if it couldn't be kept
+ */
+int render_cache_store(uint64_t fingerprint, int use_file, const char *prompt, size_t length);
+
+
+/**
+ * Forget the prompt kept in memory.
+ */
+void render_cache_clear(void);
+
+
+#endif //RENDERCACHE_H
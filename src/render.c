@@ -0,0 +1,1662 @@
+/*
+ * render.c
+ *
+ * Reads the configuration of prompt2 and renders prompts with it. See
+ * prompt2.c for an overview of Widgets and how they are configured.
+ */
+
+#include <errno.h>
+#include <git2.h>
+#include <iniparser/dictionary.h>
+#include <iniparser/iniparser.h>
+#include <limits.h>
+#include <stdio.h>
+#include <time.h>
+#include <uthash.h>
+#ifdef __unix__
+#include <linux/limits.h>
+#elif __APPLE__
+#include <sys/syslimits.h>
+#include <unistd.h> // for access()
+#else
+#error "Unknown or unsupported OS"
+#endif
+
+#include "term-attributes.h"
+#include "constants.h"
+#include "display-width.h"
+#include "emitters.h"
+#include "get-status.h"
+#include "prompt2-utils.h"
+#include "render.h"
+#include "render-cache.h"
+#include "state-cache.h"
+#include "widgets.h"
+
+
+/**
+   Max length in characters of a widget in the resulting prompt
+*/
+#define WIDGET_MAX_LEN         256
+
+/**
+   Width of terminal if I can't get it from ioctl
+*/
+#define DEFAULT_TERMINAL_WIDTH 80
+
+/**
+   Max length of a section in an ini file
+*/
+#define INI_SECTION_MAX_SIZE   64
+#define INI_SECTION_WIDGET_DEFAULT  "widget_default"
+
+
+/**
+   Hash table to store all widget configs
+   (except the default widget which is in the ConfigRoot struct)
+*/
+struct WidgetConfigMap {
+  char                *name;
+  struct WidgetConfig  config;
+  UT_hash_handle       hh; // makes this structure hashable
+};
+struct WidgetConfigMap *configurations = NULL;
+
+/**
+   The configs in the hash table which belong to a known widget,
+   interned by widget_id when the configuration is loaded
+*/
+struct WidgetConfig *widget_configs[WIDGET_COUNT];
+
+
+/**
+ * helper function for debugging
+*/
+void __print_debug_widget_config(struct WidgetConfig wc) {
+  char * reset = "\\[\\033[0m\\]";
+  printf("string_active: '%s'\n", wc.string_active);
+  printf("string_inactive: '%s'\n", wc.string_inactive);
+  printf("colour_on: '%s'%s\n", wc.colour_on, reset);
+  printf("colour_off: '%s'%s\n", wc.colour_off, reset);
+  printf("max_width: %d\n", wc.max_width);
+  printf("priority: %d\n", wc.priority);
+  printf("min_width: %d\n", wc.min_width);
+}
+
+
+/**
+ * Retrieves a widget configuration from the hash table by name.
+ *
+ * This function searches the hash table for a widget configuration
+ * with the specified name. If found, it returns a pointer to the
+ * WidgetConfig struct; otherwise, it returns NULL.
+ *
+ * @param name The name of the widget to retrieve.
+ * @return     A pointer to the WidgetConfig struct if found, or NULL
+ *             if not found.
+ */
+struct WidgetConfig *get_widget(const char *name) {
+  struct WidgetConfigMap *s;
+
+  HASH_FIND_STR(configurations, name, s);
+  if (s) {
+    return &s->config;
+  }
+  return NULL;
+}
+
+
+/**
+ * Saves the widget in the hash table for later retrieval.
+ *
+ * This function stores a WidgetConfig in a hash table, allowing it to
+ * be retrieved later by name. If a widget with the same name already
+ * exists, its configuration is updated.
+ *
+ * @param name The name of the widget to save.
+ * @param widget_config The WidgetConfig struct containing the
+ *                      widget's configuration.
+ * @return     A pointer to the saved WidgetConfig struct.
+ */
+struct WidgetConfig *save_widget(const char *name, struct WidgetConfig widget_config) {
+  struct WidgetConfigMap *s;
+
+  HASH_FIND_STR(configurations, name, s);
+  if (s == NULL) {
+    s = (struct WidgetConfigMap *)malloc(sizeof(struct WidgetConfigMap));
+    s->name = strdup(name);
+    HASH_ADD_KEYPTR(hh, configurations, s->name, strlen(s->name), s);
+  }
+  // Update the configuration
+  s->config = widget_config;
+  return &s->config;
+}
+
+
+/**
+ * Transfers INI file section into a WidgetConfig struct.
+ *
+ * This function populates a WidgetConfig struct with values from a
+ * specified INI file section. If a value is not found in the INI
+ * file, it uses the provided default values.
+ *
+ * @param ini The dictionary representing the INI file.
+ * @param section The section of the INI file to read.
+ * @param widget_config The WidgetConfig struct to populate.
+ * @param defaults The default values to use if a value is not found
+ *                 in the INI file.
+ */
+void create_widget(dictionary *ini,
+                                 const char *section,
+                                 struct WidgetConfig *widget_config,
+                                 const struct WidgetConfig *defaults) {
+  const char *default_string_active   = defaults ? defaults->string_active : "";
+  const char *default_string_inactive = defaults ? defaults->string_inactive : "";
+  const char *default_colour_on       = defaults ? defaults->colour_on : "";
+  const char *default_colour_off      = defaults ? defaults->colour_off : "";
+  const int   default_max_width       = defaults ? defaults->max_width : WIDGET_MAX_LEN;
+  const int   default_priority        = defaults ? defaults->priority : 0;
+  const int   default_min_width       = defaults ? defaults->min_width : -1;
+
+  char key[INI_SECTION_MAX_SIZE];
+  snprintf(key, sizeof(key), "%s:string_active", section);
+  widget_config->string_active = strdup(iniparser_getstring(ini, key, default_string_active));
+  snprintf(key, sizeof(key), "%s:string_inactive", section);
+  widget_config->string_inactive = strdup(iniparser_getstring(ini, key, default_string_inactive));
+  snprintf(key, sizeof(key), "%s:colour_on", section);
+  widget_config->colour_on = strdup(iniparser_getstring(ini, key, default_colour_on));
+  snprintf(key, sizeof(key), "%s:colour_off", section);
+  widget_config->colour_off = strdup(iniparser_getstring(ini, key, default_colour_off));
+  snprintf(key, sizeof(key), "%s:max_width", section);
+  widget_config->max_width = iniparser_getint(ini, key, default_max_width);
+  snprintf(key, sizeof(key), "%s:priority", section);
+  widget_config->priority = iniparser_getint(ini, key, default_priority);
+  snprintf(key, sizeof(key), "%s:min_width", section);
+  widget_config->min_width = iniparser_getint(ini, key, default_min_width);
+  widget_config->colour_codes[0] = NULL;
+  widget_config->colour_codes[1] = NULL;
+}
+
+
+/**
+ * Sets the default values for all fields in the configuration
+ * structure.
+ *
+ * This function initializes the configuration structure with default
+ * values. Any field set in the configuration file will override the
+ * corresponding default value.
+ *
+ * @param config The configuration structure to initialize with
+ *               default values.
+ */
+void set_config_defaults(struct ConfigRoot *config) {
+  // Set default prompt defaults  
+  config->default_prompt = "\\W $ ";
+  config->default_prompt_cwd_type = "home";
+  config->default_prompt_cwd_shortening = (struct CwdShortening) { CWD_SHORTEN_ELLIPSIS, 2 };
+
+  // Set git prompt defaults
+  config->git_prompt = "\\W $ ";
+  config->git_prompt_cwd_type = "home";
+  config->git_prompt_cwd_shortening = (struct CwdShortening) { CWD_SHORTEN_ELLIPSIS, 2 };
+
+  // No right prompts unless they're configured
+  config->right_prompt     = NULL;
+  config->git_right_prompt = NULL;
+
+  // Set widget defaults
+  config->defaults.string_active   = "%s";
+  config->defaults.string_inactive = "%s";
+  config->defaults.colour_on       = "";
+  config->defaults.colour_off      = "";
+  config->defaults.max_width       = WIDGET_MAX_LEN;
+  config->defaults.priority        = 0;
+  config->defaults.min_width       = -1; // @{CWD} gives way all the same
+  config->defaults.colour_codes[0] = NULL;
+  config->defaults.colour_codes[1] = NULL;
+
+  config->dynamic_default_prompt = 0;
+  config->dynamic_git_prompt     = 0;
+  config->dynamic_widget_config  = 0;
+  config->extra_backslash        = 0;
+  config->status_threads         = 0;
+  config->status_cache_ms        = 0;
+  config->duration_threshold_ms  = 2000;
+  config->shell                  = SHELL_BASH;
+  config->colour_depth           = COLOUR_DEPTH_TRUECOLOR;
+  config->needs_system_context   = 1;
+  config->needs_dir_markers      = -1;
+  config->stamp                  = FINGERPRINT_INIT;
+  config->render_cache           = 0;
+  config->default_program        = NULL;
+  config->git_program            = NULL;
+  config->right_program          = NULL;
+  config->git_right_program      = NULL;
+}
+
+
+
+/**
+ * Reads an entire file into a newly allocated string.
+ * Returns NULL on error. Caller must free the returned buffer.
+ */
+static char *read_file_content(const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return NULL;
+
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+
+  char *buf = malloc(size + 1);
+  if (!buf) { fclose(f); return NULL; }
+
+  size_t nread = fread(buf, 1, size, f);
+  fclose(f);
+  buf[nread] = '\0';
+  return buf;
+}
+
+
+/**
+ * Quick scan of raw config text for 'extra_backslash = true'.
+ * Only matches when extra_backslash is the first non-whitespace token on a line,
+ * so comment lines are naturally skipped.
+ *
+ * Returns 1 if true/yes/1, 0 otherwise.
+ */
+static int detect_extra_backslash(const char *content) {
+  const char *p = content;
+  while (*p) {
+    while (*p == ' ' || *p == '\t') p++;
+    if (strncmp(p, "extra_backslash", 15) == 0) {
+      p += 15;
+      while (*p == ' ' || *p == '\t') p++;
+      if (*p == '=') {
+        p++;
+        while (*p == ' ' || *p == '\t') p++;
+        return (*p == 't' || *p == 'T' || *p == '1' || *p == 'y' || *p == 'Y');
+      }
+    }
+    while (*p && *p != '\n') p++;
+    if (*p == '\n') p++;
+  }
+  return 0;
+}
+
+
+/**
+ * Helper: Read how a prompt's @{CWD} is shortened, `cwd_shorten` and
+ * `cwd_keep` in its section, over what it's set to already
+ * @return SUCCESS, or FAILURE if the way of shortening isn't known
+ */
+int __read_cwd_shortening(dictionary *ini, const char *section, struct CwdShortening *shortening) {
+  char key[INI_SECTION_MAX_SIZE];
+  snprintf(key, sizeof(key), "%s:cwd_keep", section);
+  shortening->keep = iniparser_getint(ini, key, shortening->keep);
+  snprintf(key, sizeof(key), "%s:cwd_shorten", section);
+  const char *strategy = iniparser_getstring(ini, key, NULL);
+  return strategy ? cwd_shorten_lookup(strategy, &shortening->strategy) : SUCCESS;
+}
+
+
+/**
+ * Handles the configuration of the prompt by loading settings from an
+ * INI file.
+ *
+ * This function sets default values for the configuration and then
+ * attempts to load and override these values from a specified INI
+ * file. If no file path is provided, it searches for a default
+ * configuration file in the current directory or the user's home
+ * directory.
+ *
+ * @param config The configuration structure to populate.
+ * @param config_file_path The path to the INI file to load. If NULL,
+ *                         a default file is searched for.
+ * @return SUCCESS unless something goes wrong
+ */
+int handle_configuration(struct ConfigRoot *config, const char *config_file_path) {
+  // Set all default values first
+  set_config_defaults(config);
+
+  char selected_config_file[PATH_MAX];
+  if (config_file_path == NULL) {
+    // Find INI file either in . or home
+    char *default_config_filename = ".prompt2_config.ini";
+    const char *config_dirs[] = {".", getenv("HOME")};
+    int found = 0;
+    for (long unsigned int i = 0; i < sizeof(config_dirs)/sizeof(config_dirs[0]); i++) {
+      snprintf(selected_config_file, PATH_MAX, "%s/%s", config_dirs[i], default_config_filename);
+      if (access(selected_config_file, R_OK) == 0) {
+        found = 1;
+        break;
+      }
+    }
+    if (!found) return ERROR_DEFAULT_INI_FILE_NOT_FOUND;
+  }
+  else {
+    if (access(config_file_path, R_OK) != 0) {
+      return ERROR_CUSTOM_INI_FILE_NOT_FOUND;
+    }
+    sprintf(selected_config_file, "%s", config_file_path);
+  }
+
+
+  // Read raw content to detect the [SYSTEM] extra_backslash flag.
+  // When true, bare backslashes in prompt values are doubled before iniparser
+  // sees the file so that iniparser 4.2.x (macOS) returns the same strings
+  // as iniparser 4.1 (Linux).
+  char *raw_content = read_file_content(selected_config_file);
+  if (!raw_content) return ERROR_INVALID_INI_FILE;
+  config->extra_backslash = detect_extra_backslash(raw_content);
+  config->stamp = fingerprint_string(config->stamp, raw_content);
+
+  dictionary *ini;
+#ifdef __APPLE__
+  if (config->extra_backslash) {
+    // Preprocess: escape bare backslashes so iniparser 4.2.x on macOS gives
+    // back the same two-char sequences that iniparser 4.1 on Linux would.
+    // fmemopen lets us hand the in-memory buffer directly to iniparser_load_file
+    // (available in iniparser >= 4.2) — no temp file needed.
+    // Important: raw_content must stay alive until after iniparser_load_file
+    // returns, because fmemopen holds a pointer into the buffer.
+    char *escaped = escape_ini_backslashes(raw_content);
+    free(raw_content);
+
+    FILE *mem_file = fmemopen((void *)escaped, strlen(escaped), "r");
+    if (!mem_file) { free(escaped); return ERROR_INVALID_INI_FILE; }
+    ini = iniparser_load_file(mem_file, selected_config_file);
+    fclose(mem_file);
+    free(escaped);
+  } else {
+    free(raw_content);
+    ini = iniparser_load(selected_config_file);
+  }
+#else
+  free(raw_content);
+  ini = iniparser_load(selected_config_file);
+#endif
+
+  if (ini == NULL) return ERROR_INVALID_INI_FILE;
+
+  config->status_threads  = iniparser_getint(ini, "SYSTEM:status_threads",  config->status_threads);
+  config->status_cache_ms = iniparser_getint(ini, "SYSTEM:status_cache_ms", config->status_cache_ms);
+  config->render_cache    = iniparser_getboolean(ini, "SYSTEM:render_cache", config->render_cache);
+  config->duration_threshold_ms = iniparser_getint(ini, "Cmd.duration:threshold_ms",
+                                                   config->duration_threshold_ms);
+  const char *shell = iniparser_getstring(ini, "SYSTEM:shell", "bash");
+  if (shell_dialect_lookup(shell, &config->shell) != SUCCESS) {
+    iniparser_freedict(ini);
+    return ERROR_INVALID_INI_FILE;
+  }
+  const char *colour_depth = iniparser_getstring(ini, "SYSTEM:colour_depth", "auto");
+  if (colour_depth_lookup(colour_depth, &config->colour_depth) != SUCCESS) {
+    iniparser_freedict(ini);
+    return ERROR_INVALID_INI_FILE;
+  }
+  // the colours are rendered for it once, with the attributes
+  set_attribute_colour_depth(config->colour_depth);
+  config->stamp = fingerprint_int(config->stamp, config->colour_depth);
+
+  // set all prompt configs to user-provided default settings (if it exists)
+  if (iniparser_find_entry(ini, "PROMPT") == 1) {
+    config->default_prompt          = strdup(iniparser_getstring(ini, "PROMPT:prompt",     config->default_prompt));
+    config->git_prompt              = strdup(iniparser_getstring(ini, "PROMPT:prompt",     config->default_prompt));
+
+    config->default_prompt_cwd_type = strdup(iniparser_getstring(ini, "PROMPT:cwd_type",   config->default_prompt_cwd_type));
+    config->git_prompt_cwd_type     = strdup(iniparser_getstring(ini, "PROMPT:cwd_type",   config->default_prompt_cwd_type));
+    config->dynamic_default_prompt = 1;
+
+    if (__read_cwd_shortening(ini, "PROMPT", &config->default_prompt_cwd_shortening) != SUCCESS) {
+      iniparser_freedict(ini);
+      return ERROR_INVALID_INI_FILE;
+    }
+    config->git_prompt_cwd_shortening = config->default_prompt_cwd_shortening;
+  }
+
+  // if there is a git prompt config section, override the default (above) with this
+  if (iniparser_find_entry(ini, "PROMPT.GIT") == 1) {
+    config->git_prompt          = strdup(iniparser_getstring(ini, "PROMPT.GIT:prompt",     config->git_prompt));
+    config->git_prompt_cwd_type = strdup(iniparser_getstring(ini, "PROMPT.GIT:cwd_type",   config->git_prompt_cwd_type));
+    config->dynamic_git_prompt = 1;
+
+    if (__read_cwd_shortening(ini, "PROMPT.GIT", &config->git_prompt_cwd_shortening) != SUCCESS) {
+      iniparser_freedict(ini);
+      return ERROR_INVALID_INI_FILE;
+    }
+  }
+
+  // if either right prompt section is there, both prompts get a right
+  // prompt: the git one falls back on the default one, which falls
+  // back on nothing
+  int has_right_prompt     = iniparser_find_entry(ini, "PROMPT.RIGHT") == 1;
+  int has_git_right_prompt = iniparser_find_entry(ini, "PROMPT.GIT.RIGHT") == 1;
+  if (has_right_prompt || has_git_right_prompt) {
+    config->right_prompt     = strdup(iniparser_getstring(ini, "PROMPT.RIGHT:prompt", ""));
+    config->git_right_prompt = strdup(iniparser_getstring(ini, "PROMPT.GIT.RIGHT:prompt", config->right_prompt));
+  }
+
+  // Set default widget to fall back on
+  if (iniparser_find_entry(ini, INI_SECTION_WIDGET_DEFAULT) == 1) {
+    create_widget(ini, INI_SECTION_WIDGET_DEFAULT, &config->defaults, &config->defaults);
+    config->dynamic_widget_config = 1;
+  }
+
+  // Read each ini section
+  for (int i = 0; i < iniparser_getnsec(ini); i++) {
+    const char * section = iniparser_getsecname(ini, i);
+    if (strcmp(section, INI_SECTION_WIDGET_DEFAULT) == 0) continue;
+    if (strcmp(section, "system") == 0) continue;
+
+    struct WidgetConfig wc = { NULL, NULL, NULL, NULL, 0, 0, -1, { NULL, NULL } };
+    create_widget(ini, section, &wc, &config->defaults);
+    struct WidgetConfig *saved = save_widget(section, wc);
+
+    // so rendering finds it by widget_id, without hashing the name
+    enum widget_id id = widget_lookup(section, strlen(section));
+    if (id != WIDGET_UNKNOWN) {
+      widget_configs[id] = saved;
+    }
+  }
+
+  // Free the dictionary
+  iniparser_freedict(ini);
+  return SUCCESS;
+}
+
+/**
+ * Helper: The colour of a widget, active or not, with its terminal
+ * attributes rendered. Rendered the first time it's needed, and kept
+ * with the widget's configuration.
+ */
+const char *__widget_colour(struct WidgetConfig *wc, int is_active, dictionary *attribute_dict) {
+  if (wc->colour_codes[is_active] == NULL) {
+    const char *colour = is_active ? wc->colour_on : wc->colour_off;
+    const char *codes = replace_attribute_tokens(colour, attribute_dict);
+    wc->colour_codes[is_active] = (codes == colour) ? strdup(colour) : (char *) codes;
+  }
+  return wc->colour_codes[is_active];
+}
+
+
+/**
+ * Helper: The configuration of a widget, or the defaults if it has
+ * none of its own
+ */
+struct WidgetConfig *__config_of(enum widget_id id, struct WidgetConfig *defaults) {
+  return widget_configs[id] ? widget_configs[id] : defaults;
+}
+
+
+/**
+ * Formats the display string of a widget based on its configuration
+ * and state. It determines the widget's appearance in the prompt,
+ * including its text and color, based on whether it is active or
+ * inactive.
+ *
+ * @param id The widget.
+ * @param value The value to be displayed by the widget.
+ * @param is_active Indicates if the widget is active (1) or inactive (0).
+ * @param defaults Default configuration for widgets.
+ * @param attribute_dict Dictionary of terminal attribute escape codes.
+ * @param coloured_widget Set to the formatted widget.
+ * @return The length of the formatted widget.
+ */
+size_t format_widget(enum widget_id id,
+                     const char *value,
+                     int is_active,
+                     struct WidgetConfig *defaults,
+                     dictionary *attribute_dict,
+                     char coloured_widget[WIDGET_MAX_LEN]) {
+  struct WidgetConfig *wc = __config_of(id, defaults);
+  // Format the value (a copy, as it may be shortened)
+  char value_to_format[PATH_MAX];
+  snprintf(value_to_format, sizeof(value_to_format), "%s", value);
+
+  if (wc->max_width >= 0 &&
+      display_width(value_to_format, strlen(value_to_format)) > wc->max_width) {
+    if (id == WIDGET_CWD) {
+      shorten_path(value_to_format, wc->max_width);
+    }
+    else {
+      truncate_with_ellipsis(value_to_format, (size_t) wc->max_width);
+    }
+  }
+
+  char widget[WIDGET_MAX_LEN];
+  const char *format_string = is_active ? wc->string_active : wc->string_inactive;
+  snprintf(widget, sizeof(widget), format_string, value_to_format);
+  
+  // Wrap resulting string in colours
+  const char *colour_string = __widget_colour(wc, is_active, attribute_dict);
+
+  // define reset if colours were added in the preceding step
+  const char *reset_term_colours = "";
+  if (strstr(colour_string, "\\[\\033[") != NULL || strstr(colour_string, "\\[\\e[") != NULL) {
+    reset_term_colours = "\\[\\033[0m\\]";
+  }
+  snprintf(coloured_widget, WIDGET_MAX_LEN, "%s%s%s", colour_string, widget, reset_term_colours);
+  return strlen(coloured_widget);
+}
+
+
+/**
+   A piece of a prompt: either literal text, or a widget token
+*/
+struct PromptSegment {
+  enum widget_id  id;     // the widget, or WIDGET_UNKNOWN for text to keep as it is
+  const char     *text;   // the text, or the token as written, e.g. "@{Repo.name}"
+  size_t          length;
+};
+
+/**
+   Where splitting a scanned prompt into segments has got to
+*/
+struct SegmentCursor {
+  const struct PromptMarkers *scan;
+  size_t marker;   // the next marker to look at
+  size_t position; // in the prompt
+};
+
+/**
+ * Helper: Split the next segment off a scanned prompt. Widget tokens
+ * are denoted by the syntax `@{token}`. A token interrupted by
+ * another `@{`, or left open at the end of the prompt, is dropped.
+ *
+ * @param cursor   Where the prompt continues; moved past the segment.
+ * @param segment  Set to the segment.
+ * @return 1 if there was a segment, 0 at the end of the prompt
+ */
+int __next_segment(struct SegmentCursor *cursor, struct PromptSegment *segment) {
+  const struct PromptMarkers *scan = cursor->scan;
+  size_t start = cursor->position;
+  const char *wtoken = NULL;
+
+  for (; cursor->marker < scan->count; cursor->marker++) {
+    const struct PromptMarker *marker = &scan->markers[cursor->marker];
+    if (marker->type == MARKER_WIDGET) {
+      if (!wtoken && marker->offset > start) {
+        // the text ends here
+        cursor->position = marker->offset;
+        segment->id     = WIDGET_UNKNOWN;
+        segment->text   = scan->str + start;
+        segment->length = marker->offset - start;
+        return 1;
+      }
+      wtoken = scan->str + marker->offset;
+    } else if (marker->type == MARKER_CLOSE && wtoken) {
+      cursor->marker++;
+      cursor->position = marker->offset + 1; // Move past the '}'
+      segment->id     = widget_lookup(wtoken + 2, scan->str + marker->offset - wtoken - 2);
+      segment->text   = wtoken;
+      segment->length = scan->str + cursor->position - wtoken;
+      return 1;
+    }
+  }
+
+  cursor->position = scan->length;
+  if (wtoken || scan->length == start) return 0;
+  segment->id     = WIDGET_UNKNOWN;
+  segment->text   = scan->str + start;
+  segment->length = scan->length - start;
+  return 1;
+}
+
+/**
+ * Helper: Append a segment to the prompt - the formatted widget if
+ * its value is known, otherwise the segment as it is.
+ * @return SUCCESS, or FAILURE if the prompt would exceed PROMPT_MAX_LEN
+ */
+int __append_segment(char *prompt,
+                     size_t *prompt_length,
+                     const struct PromptSegment *segment,
+                     const struct WidgetContext *context,
+                     struct WidgetConfig *defaults,
+                     dictionary *attribute_dict) {
+  const char *text = segment->text;
+  size_t length = segment->length;
+  char formatted[WIDGET_MAX_LEN];
+
+  if (segment->id != WIDGET_UNKNOWN && (context->known & WIDGET_BIT(segment->id))) {
+    char number[ITOA_BUFFER_SIZE];
+    length = format_widget(segment->id,
+                           widget_value(segment->id, context, number, sizeof(number)),
+                           widget_is_active(segment->id, context),
+                           defaults,
+                           attribute_dict,
+                           formatted);
+    text = formatted;
+  }
+
+  if (*prompt_length + length >= PROMPT_MAX_LEN) {
+    return FAILURE;
+  }
+  memcpy(prompt + *prompt_length, text, length);
+  *prompt_length += length;
+  prompt[*prompt_length] = '\0';
+  return SUCCESS;
+}
+
+
+/**
+ * Helper: parse_prompt() for a scanned prompt
+ */
+char *__parse_scanned(const struct PromptMarkers *scan,
+                      const struct WidgetContext *context,
+                      struct WidgetConfig *defaults,
+                      dictionary *attribute_dict) {
+  char prompt[PROMPT_MAX_LEN] = "";
+  size_t length = 0;
+  struct SegmentCursor cursor = { scan, 0, 0 };
+  struct PromptSegment segment;
+
+  while (__next_segment(&cursor, &segment)) {
+    if (__append_segment(prompt, &length, &segment, context, defaults, attribute_dict) == FAILURE) {
+      return strdup("PROMPT TOO LONG $ ");
+    }
+  }
+  return strdup(prompt);
+}
+
+
+/**
+ * Parses a given input prompt string, replacing any embedded widget
+ * tokens with their corresponding values. Widget tokens are denoted
+ * by the syntax `@{token}` and are replaced by the widget's formatted
+ * string based on the current environment state and widget
+ * configuration. The function ensures the length of the resulting
+ * prompt does not exceed `PROMPT_MAX_LEN`. If a widget token is
+ * unknown, or its value isn't known yet, it is left unchanged in the
+ * output.
+ *
+ * @param unparsed_prompt The input prompt string containing embedded
+ *                        widget tokens to be parsed.
+
+ * @param context         The state, and which widgets' values are
+ *                        known.
+
+ * @param defaults        A pointer to a `WidgetConfig` struct
+ *                        containing the default widget configuration.
+
+ * @param attribute_dict  A dictionary of terminal attribute escape codes.
+
+ * @return A dynamically allocated string containing the digested
+ *         prompt. If the resulting prompt would exceed
+ *         `PROMPT_MAX_LEN`, a predefined error message is returned
+ *         instead. The caller is responsible for freeing the returned
+ *         string.
+ */
+const char *parse_prompt(const char *unparsed_prompt,
+                         const struct WidgetContext *context,
+                         struct WidgetConfig *defaults,
+                         dictionary *attribute_dict) {
+  struct PromptMarkers scan;
+  scan_prompt_markers(unparsed_prompt, &scan);
+  char *prompt = __parse_scanned(&scan, context, defaults, attribute_dict);
+  free_prompt_markers(&scan);
+  return prompt;
+}
+
+
+/**
+ * Widgets whose values need libgit2 to open the repository. Everything
+ * else in the Repo namespace is read straight from the .git directory.
+ */
+#define WIDGETS_LIBGIT2 (WIDGET_BIT(WIDGET_REPO_CONFLICTS) | WIDGET_BIT(WIDGET_REPO_HAS_UPSTREAM) | \
+                         WIDGET_BIT(WIDGET_REPO_AHEAD) | WIDGET_BIT(WIDGET_REPO_BEHIND) | \
+                         WIDGET_BIT(WIDGET_REPO_STAGED) | WIDGET_BIT(WIDGET_REPO_MODIFIED) | \
+                         WIDGET_BIT(WIDGET_REPO_UNTRACKED))
+
+/**
+ * Helper: the widgets a (prompt or widget format) string refers to
+ */
+widget_set __widgets_in(const char *str) {
+  if (str == NULL) return 0;
+
+  widget_set widgets = 0;
+  struct PromptMarkers scan;
+  scan_prompt_markers(str, &scan);
+  struct SegmentCursor cursor = { &scan, 0, 0 };
+  struct PromptSegment segment;
+  while (__next_segment(&cursor, &segment)) {
+    if (segment.id != WIDGET_UNKNOWN) widgets |= WIDGET_BIT(segment.id);
+  }
+  free_prompt_markers(&scan);
+  return widgets;
+}
+
+/**
+ * Helper: the widgets the prompt, or any of the widget formats,
+ * refers to
+ */
+widget_set __widgets_used(const char *prompt, const struct WidgetConfig *defaults) {
+  widget_set widgets = __widgets_in(prompt) |
+                       __widgets_in(defaults->string_active) |
+                       __widgets_in(defaults->string_inactive);
+
+  struct WidgetConfigMap *current, *tmp;
+  HASH_ITER(hh, configurations, current, tmp) {
+    widgets |= __widgets_in(current->config.string_active) |
+               __widgets_in(current->config.string_inactive);
+  }
+  return widgets;
+}
+
+/**
+ * Helper: check if the prompt, or any of the widget formats, refers
+ * to one of the widgets in wanted
+ */
+int __uses_widgets(const char *prompt, const struct WidgetConfig *defaults, widget_set wanted) {
+  return (__widgets_used(prompt, defaults) & wanted) ? SUCCESS : FAILURE;
+}
+
+/**
+ * Helper: check if any of the prompts shows a widget found by the
+ * files in the directories above the cwd
+ */
+int __needs_dir_markers(const struct ConfigRoot *config) {
+  const widget_set wanted = WIDGETS_PROJECT | WIDGETS_PYTHON | WIDGETS_NODE;
+  return __uses_widgets(config->default_prompt, &config->defaults, wanted) == SUCCESS ||
+         __uses_widgets(config->git_prompt, &config->defaults, wanted) == SUCCESS ||
+         (config->right_prompt && (__widgets_in(config->right_prompt) & wanted)) ||
+         (config->git_right_prompt && (__widgets_in(config->git_right_prompt) & wanted));
+}
+
+/**
+ * Check if rendering the prompt needs libgit2, i.e. if the prompt or
+ * any of the widget formats shows the status of the repository.
+ * @return SUCCESS if it does, FAILURE if not
+ */
+int uses_libgit2_widgets(const char *prompt, const struct WidgetConfig *defaults) {
+  return __uses_widgets(prompt, defaults, WIDGETS_LIBGIT2);
+}
+
+
+/**
+ * Load the configuration from an INI file, and check that the
+ * prompts in it are well-formed.
+ */
+int load_configuration(struct ConfigRoot *config,
+                       const char *config_file_path,
+                       char *error,
+                       size_t error_size) {
+  int retval = handle_configuration(config, config_file_path);
+  if (retval != SUCCESS) {
+    if (retval == ERROR_CUSTOM_INI_FILE_NOT_FOUND) {
+      snprintf(error, error_size, "USER-SPECIFIED INI FILE '%s' NOT FOUND\n$ ", config_file_path);
+    }
+    if (retval == ERROR_DEFAULT_INI_FILE_NOT_FOUND) {
+      snprintf(error, error_size, "INI FILE '.prompt2_config.ini' NOT FOUND IN $HOME OR '.'\n$ ");
+    }
+    if (retval == ERROR_INVALID_INI_FILE) {
+      snprintf(error, error_size, "INVALID INI FILE\n$ ");
+    }
+    return retval;
+  }
+
+  if (are_escape_sequences_properly_formed(config->default_prompt) != SUCCESS) {
+    snprintf(error, error_size, "MALFORMED DEFAULT_PROMPT $ ");
+    return ERROR;
+  }
+  if (are_escape_sequences_properly_formed(config->git_prompt) != SUCCESS) {
+    snprintf(error, error_size, "MALFORMED GIT_PROMPT $ ");
+    return ERROR;
+  }
+  if (config->right_prompt &&
+      (are_escape_sequences_properly_formed(config->right_prompt) != SUCCESS ||
+       are_escape_sequences_properly_formed(config->git_right_prompt) != SUCCESS)) {
+    snprintf(error, error_size, "MALFORMED RIGHT_PROMPT $ ");
+    return ERROR;
+  }
+  return SUCCESS;
+}
+
+
+/**
+   A prompt compiled for render_prompt(): its terminal attributes
+   rendered, and split into segments, with each widget token resolved
+   to its widget
+*/
+struct PromptProgram {
+  char                 *text;     // the segments point in here
+  struct PromptSegment *segments;
+  size_t                count;
+  int                   uses_libgit2;
+  widget_set            widgets;      // those it, or a widget format, refers to
+};
+
+/**
+ * Helper: Compile a prompt into a PromptProgram
+ */
+struct PromptProgram *__compile_program(const char *prompt,
+                                        const struct WidgetConfig *defaults,
+                                        dictionary *attribute_dict) {
+  struct PromptProgram *program = calloc(1, sizeof(struct PromptProgram));
+  char *attributed = (char *) replace_attribute_tokens(prompt, attribute_dict);
+  // for tokenization on \n to work, we need to replace the string "\n" with a newline character.
+  program->text = replace_literal_newlines(attributed);
+  free(attributed);
+  program->uses_libgit2 = uses_libgit2_widgets(program->text, defaults) == SUCCESS;
+  program->widgets      = __widgets_used(program->text, defaults);
+
+  struct PromptMarkers scan;
+  scan_prompt_markers(program->text, &scan);
+  struct SegmentCursor cursor = { &scan, 0, 0 };
+  struct PromptSegment segment;
+  while (__next_segment(&cursor, &segment)) program->count++;
+
+  program->segments = malloc((program->count + 1) * sizeof(struct PromptSegment));
+  cursor = (struct SegmentCursor) { &scan, 0, 0 };
+  for (size_t i = 0; __next_segment(&cursor, &program->segments[i]); i++);
+  free_prompt_markers(&scan);
+  return program;
+}
+
+/**
+ * Helper: Free a PromptProgram (or NULL)
+ */
+void __free_program(struct PromptProgram *program) {
+  if (program) {
+    free(program->text);
+    free(program->segments);
+    free(program);
+  }
+}
+
+/**
+ * Free everything load_configuration() allocated.
+ */
+void free_configuration(struct ConfigRoot *config) {
+  __free_program(config->default_program);
+  __free_program(config->git_program);
+  __free_program(config->right_program);
+  __free_program(config->git_right_program);
+  config->default_program   = NULL;
+  config->git_program       = NULL;
+  config->right_program     = NULL;
+  config->git_right_program = NULL;
+
+  free(config->right_prompt);
+  free(config->git_right_prompt);
+  config->right_prompt     = NULL;
+  config->git_right_prompt = NULL;
+
+  if (config->dynamic_default_prompt) {
+    free(config->default_prompt);
+    free(config->default_prompt_cwd_type);
+  }
+  if (config->dynamic_git_prompt) {
+    free(config->git_prompt);
+    free(config->git_prompt_cwd_type);
+  }
+  free(config->defaults.colour_codes[0]);
+  free(config->defaults.colour_codes[1]);
+  config->defaults.colour_codes[0] = NULL;
+  config->defaults.colour_codes[1] = NULL;
+  if (config->dynamic_widget_config) {
+    free(config->defaults.string_active);
+    free(config->defaults.string_inactive);
+    free(config->defaults.colour_on);
+    free(config->defaults.colour_off);
+  }
+  config->dynamic_default_prompt = 0;
+  config->dynamic_git_prompt     = 0;
+  config->dynamic_widget_config  = 0;
+
+  memset(widget_configs, 0, sizeof(widget_configs));
+  struct WidgetConfigMap *current, *tmp;
+  HASH_ITER(hh, configurations, current, tmp) {
+    HASH_DEL(configurations, current);
+    free(current->config.string_active);
+    free(current->config.string_inactive);
+    free(current->config.colour_on);
+    free(current->config.colour_off);
+    free(current->config.colour_codes[0]);
+    free(current->config.colour_codes[1]);
+    free(current->name);
+    free(current);
+  }
+}
+
+
+/**
+ * Helper: Replace the prompts of the configuration with new ones
+ * (which the configuration then owns). The right prompts are either
+ * both NULL or neither.
+ */
+void __replace_prompts(struct ConfigRoot *config,
+                       char *default_prompt,
+                       char *git_prompt,
+                       char *right_prompt,
+                       char *git_right_prompt) {
+  if (config->dynamic_default_prompt) {
+    free(config->default_prompt);
+  }
+  else {
+    config->default_prompt_cwd_type = strdup(config->default_prompt_cwd_type);
+  }
+  if (config->dynamic_git_prompt) {
+    free(config->git_prompt);
+  }
+  else {
+    config->git_prompt_cwd_type = strdup(config->git_prompt_cwd_type);
+  }
+  free(config->right_prompt);
+  free(config->git_right_prompt);
+  config->default_prompt   = default_prompt;
+  config->git_prompt       = git_prompt;
+  config->right_prompt     = right_prompt;
+  config->git_right_prompt = git_right_prompt;
+  config->dynamic_default_prompt = 1;
+  config->dynamic_git_prompt     = 1;
+  config->stamp = fingerprint_string(fingerprint_string(config->stamp, default_prompt), git_prompt);
+  config->stamp = fingerprint_string(fingerprint_string(config->stamp, right_prompt), git_right_prompt);
+
+  __free_program(config->default_program);
+  __free_program(config->git_program);
+  __free_program(config->right_program);
+  __free_program(config->git_right_program);
+  config->default_program   = NULL;
+  config->git_program       = NULL;
+  config->right_program     = NULL;
+  config->git_right_program = NULL;
+
+  config->needs_system_context =
+    __uses_widgets(default_prompt, &config->defaults, WIDGETS_SYSTEM) == SUCCESS ||
+    __uses_widgets(git_prompt, &config->defaults, WIDGETS_SYSTEM) == SUCCESS ||
+    (right_prompt && (__widgets_in(right_prompt) & WIDGETS_SYSTEM)) ||
+    (git_right_prompt && (__widgets_in(git_right_prompt) & WIDGETS_SYSTEM));
+  config->needs_dir_markers = -1;
+}
+
+/**
+ * Helper: Render the terminal attributes, and the widgets known to
+ * the context, into a prompt. Other widgets are left as they are.
+ */
+char *__compile_prompt(const char *prompt,
+                       const struct WidgetContext *context,
+                       struct WidgetConfig *defaults,
+                       dictionary *attribute_dict) {
+  char *attributed = (char *) replace_attribute_tokens(prompt, attribute_dict);
+  char *compiled = (char *) parse_prompt(attributed, context, defaults, attribute_dict);
+  free(attributed);
+  return compiled;
+}
+
+
+/**
+ * Partially evaluate the prompts of the configuration.
+ */
+int compile_configuration(struct ConfigRoot *config, dictionary *attribute_dict) {
+  struct CurrentState state;
+  initialise_state(&state, NULL);
+  if (gather_system_context(&state) != SUCCESS) {
+    return FAILURE; // render_prompt() will have to try again
+  }
+
+  struct WidgetContext context = { .state = &state, .known = WIDGETS_SYSTEM };
+  char *default_prompt = __compile_prompt(config->default_prompt, &context,
+                                          &config->defaults, attribute_dict);
+  char *git_prompt     = __compile_prompt(config->git_prompt, &context,
+                                          &config->defaults, attribute_dict);
+  char *right_prompt     = NULL;
+  char *git_right_prompt = NULL;
+  if (config->right_prompt) {
+    right_prompt     = __compile_prompt(config->right_prompt, &context,
+                                        &config->defaults, attribute_dict);
+    git_right_prompt = __compile_prompt(config->git_right_prompt, &context,
+                                        &config->defaults, attribute_dict);
+  }
+  cleanup_resources(&state);
+
+  __replace_prompts(config, default_prompt, git_prompt, right_prompt, git_right_prompt);
+  return SUCCESS;
+}
+
+
+/**
+ * The prompts of the configuration, as a template for
+ * apply_template().
+ */
+char *configuration_template(const struct ConfigRoot *config) {
+  size_t size = strlen(config->default_prompt) + strlen(config->git_prompt) + 2;
+  if (config->right_prompt) {
+    size += strlen(config->right_prompt) + strlen(config->git_right_prompt) + 2;
+  }
+  char *template = malloc(size);
+  if (template && config->right_prompt) {
+    snprintf(template, size, "%s\n%s\n%s\n%s", config->default_prompt, config->git_prompt,
+             config->right_prompt, config->git_right_prompt);
+  }
+  else if (template) {
+    snprintf(template, size, "%s\n%s", config->default_prompt, config->git_prompt);
+  }
+  return template;
+}
+
+
+/**
+ * Use the prompts in a template from configuration_template().
+ */
+int apply_template(struct ConfigRoot *config, const char *template) {
+  const char *newline = strchr(template, '\n');
+  if (!newline) return FAILURE;
+  char *default_prompt = strndup(template, newline - template);
+
+  // then either the git prompt, or it and the right prompts
+  const char *git = newline + 1;
+  const char *right = strchr(git, '\n');
+  const char *git_right = right ? strchr(right + 1, '\n') : NULL;
+  if (!git_right) {
+    __replace_prompts(config, default_prompt, strdup(git), NULL, NULL);
+  }
+  else {
+    __replace_prompts(config, default_prompt, strndup(git, right - git),
+                      strndup(right + 1, git_right - right - 1), strdup(git_right + 1));
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * libgit2 is initialised the first time a prompt needs it, and kept
+ * until render_shutdown().
+ */
+static int libgit2_initialised = 0;
+
+/**
+ * Helper: Gather the status of the repo - from the status cache if
+ * another shell has just worked it out, otherwise with libgit2.
+ */
+void __gather_repo_status(struct ConfigRoot *config, struct CurrentState *state) {
+  if (status_cache_load(state, config->status_cache_ms) == SUCCESS) return;
+
+  if (!libgit2_initialised) {
+    if (lazy_load_libgit2() != SUCCESS) return;
+    git_libgit2_init();
+    libgit2_initialised = 1;
+  }
+
+  gather_git_context(state);
+  if (config->status_cache_ms > 0 && state->staged_num >= 0) {
+    status_cache_store(state);
+  }
+}
+
+
+/**
+ * Helper: The milliseconds since a time, in microseconds since the
+ * epoch, up to INT_MAX
+ */
+int __milliseconds_since(int64_t microseconds) {
+  struct timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+  int64_t elapsed = ((int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000 - microseconds) / 1000;
+  if (elapsed < 0) return 0;
+  return elapsed > INT_MAX ? INT_MAX : (int) elapsed;
+}
+
+
+/**
+ * Helper: Fingerprint everything a prompt is rendered from: the
+ * configuration, the request, the gathered state, and the directories
+ * listed for unique cwd prefixes
+ */
+uint64_t __render_fingerprint(const struct ConfigRoot *config,
+                              enum shell_dialect shell,
+                              const struct RenderRequest *request,
+                              const struct CurrentState *state,
+                              const struct CwdShortening *cwd_shortening) {
+  uint64_t fp = config->stamp;
+  fp = fingerprint_int(fp, shell);
+  fp = fingerprint_int(fp, request->terminal_width);
+  fp = fingerprint_string(fp, getenv("HOME")); // for CWD.home_path
+
+  fp = fingerprint_string(fp, state->cwd_full);
+  fp = fingerprint_string(fp, state->repo_path);
+  fp = fingerprint_int(fp, state->head_oid != NULL);
+  fp = fingerprint_string(fp, state->repo_name);
+  fp = fingerprint_string(fp, state->branch_name);
+  fp = fingerprint_string(fp, state->username);
+  fp = fingerprint_string(fp, state->hostname);
+  fp = fingerprint_int(fp, state->uid);
+  fp = fingerprint_int(fp, state->gid);
+
+  fp = fingerprint_int(fp, state->is_git_repo);
+  fp = fingerprint_int(fp, state->is_nascent_repo);
+  fp = fingerprint_int(fp, state->has_upstream);
+  fp = fingerprint_int(fp, state->conflict_num);
+  fp = fingerprint_int(fp, state->is_rebase_in_progress);
+  fp = fingerprint_int(fp, state->is_merge_in_progress);
+  fp = fingerprint_int(fp, state->is_cherry_pick_in_progress);
+  fp = fingerprint_int(fp, state->is_revert_in_progress);
+  fp = fingerprint_int(fp, state->is_bisect_in_progress);
+  fp = fingerprint_string(fp, state->rebase_step);
+  fp = fingerprint_string(fp, state->repo_state);
+
+  fp = fingerprint_int(fp, state->ahead_num);
+  fp = fingerprint_int(fp, state->behind_num);
+  fp = fingerprint_int(fp, state->staged_num);
+  fp = fingerprint_int(fp, state->modified_num);
+  fp = fingerprint_int(fp, state->untracked_num);
+
+  fp = fingerprint_int(fp, state->aws_token_is_valid);
+  fp = fingerprint_int(fp, state->aws_token_remaining_hours);
+  fp = fingerprint_int(fp, state->aws_token_remaining_minutes);
+
+  fp = fingerprint_string(fp, state->project_type);
+  fp = fingerprint_string(fp, state->project_name);
+  fp = fingerprint_string(fp, state->k8s_context);
+  fp = fingerprint_string(fp, state->k8s_namespace);
+  fp = fingerprint_string(fp, state->env_venv);
+  fp = fingerprint_string(fp, state->env_conda);
+  fp = fingerprint_string(fp, state->env_python_version);
+  fp = fingerprint_string(fp, state->env_node_version);
+
+  fp = fingerprint_int(fp, state->exit_status);
+
+  // the duration as @{Cmd.duration} shows it, rather than to the
+  // millisecond, which would be different after every command
+  int duration = state->command_duration_ms;
+  int duration_is_active = duration >= 0 && duration >= config->duration_threshold_ms;
+  const struct WidgetConfig *duration_config = widget_configs[WIDGET_CMD_DURATION] ?: &config->defaults;
+  fp = fingerprint_int(fp, duration_is_active);
+  if (duration >= 0 &&
+      strchr(duration_is_active ? duration_config->string_active : duration_config->string_inactive, '%')) {
+    char formatted[32];
+    format_duration(duration, formatted, sizeof(formatted));
+    fp = fingerprint_string(fp, formatted);
+  }
+
+  if (cwd_shortening->strategy == CWD_SHORTEN_UNIQUE && state->cwd_full) {
+    fp = cwd_shorten_fingerprint(fp, state->cwd_full);
+  }
+  return fp;
+}
+
+
+/**
+   A piece of a line of the prompt, as __layout_line() sees it: text,
+   or a widget, and the terminal columns it takes up
+*/
+struct LayoutItem {
+  enum widget_id  id;          // WIDGET_UNKNOWN for text (and unknown tokens)
+  const char     *text;
+  size_t          length;
+  int             width;
+  int             value_width; // of width, the columns of the widget's value
+  char           *nested;      // text, if widgets in the widget were filled in
+  char            formatted[WIDGET_MAX_LEN];
+};
+
+/**
+   A widget of a line which may give way, and when: lowest priority
+   first, and of those the right-most first
+*/
+struct GiveWay {
+  int    priority;
+  size_t item;     // index into the line's items
+};
+
+/**
+ * Helper: Order GiveWays by when they give way
+ */
+int __compare_give_way(const void *a, const void *b) {
+  const struct GiveWay *give_way_a = a;
+  const struct GiveWay *give_way_b = b;
+  if (give_way_a->priority != give_way_b->priority) {
+    return give_way_a->priority < give_way_b->priority ? -1 : 1;
+  }
+  return give_way_a->item < give_way_b->item ? 1 : -1;
+}
+
+/**
+ * Helper: Format a widget into a LayoutItem, with its value shortened
+ * to value_limit columns (or as it's configured, if that's less), and
+ * measure it. Widgets in the widget (see "Nesting widgets") are
+ * filled in too, one layer deep.
+ */
+void __format_item(struct LayoutItem *item,
+                   int value_limit,
+                   const struct WidgetContext *context,
+                   struct WidgetConfig *defaults,
+                   dictionary *attribute_dict) {
+  char number[ITOA_BUFFER_SIZE];
+  char value[PATH_MAX];
+  snprintf(value, sizeof(value), "%s", widget_value(item->id, context, number, sizeof(number)));
+
+  int max_width = __config_of(item->id, defaults)->max_width;
+  if (max_width >= 0 && max_width < value_limit) value_limit = max_width;
+  item->value_width = display_width(value, strlen(value));
+  if (item->value_width > value_limit) {
+    if (item->id == WIDGET_CWD && context->cwd_shortening) {
+      shorten_cwd(value, value_limit, context->cwd_shortening, context->state->cwd_full);
+    }
+    else if (item->id == WIDGET_CWD) {
+      shorten_path(value, value_limit);
+    }
+    else {
+      truncate_with_ellipsis(value, (size_t) value_limit);
+    }
+    item->value_width = display_width(value, strlen(value));
+  }
+
+  item->length = format_widget(item->id, value, widget_is_active(item->id, context),
+                               defaults, attribute_dict, item->formatted);
+  item->text = item->formatted;
+  free(item->nested);
+  item->nested = NULL;
+  if (strstr(item->formatted, "@{")) {
+    item->nested = (char *) parse_prompt(item->formatted, context, defaults, attribute_dict);
+    item->text = item->nested;
+    item->length = strlen(item->nested);
+  }
+  item->width = count_visible_chars(item->text);
+}
+
+/**
+ * Helper: The narrowest a widget of a line may be shrunk to, or -1 if
+ * it can't be. Unless it's configured, @{CWD} gives way all the way.
+ */
+int __min_width_of(const struct LayoutItem *item, struct WidgetConfig *defaults) {
+  if (item->id == WIDGET_UNKNOWN || item->id == WIDGET_SPC) return -1;
+  int min_width = __config_of(item->id, defaults)->min_width;
+  return (min_width < 0 && item->id == WIDGET_CWD) ? 0 : min_width;
+}
+
+/**
+ * Helper: Lay out a line of the prompt for the terminal: if it's too
+ * wide, its widgets give way - lowest priority first, and of those
+ * the right-most first - each shrunk as far as needed, but no further
+ * than its min_width, and dropped if its value doesn't fit at all.
+ * Whatever room is left is then shared by the @{SPC}s.
+ *
+ * Every item is measured once, and only those which give way are
+ * formatted again.
+ *
+ * @param order  Room for count GiveWays, to sort the widgets in.
+ * @return the width of the line
+ */
+int __layout_line(struct LayoutItem *items,
+                  size_t count,
+                  struct GiveWay *order,
+                  int terminal_width,
+                  struct WidgetContext *context,
+                  struct WidgetConfig *defaults,
+                  dictionary *attribute_dict) {
+  int width = 0;
+  size_t spaces = 0;
+  size_t giving_way = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    width += items[i].width;
+    if (items[i].id == WIDGET_SPC) spaces++;
+    if (__min_width_of(&items[i], defaults) < 0) continue;
+    order[giving_way++] = (struct GiveWay) { __config_of(items[i].id, defaults)->priority, i };
+  }
+
+  // only sorted if something has to give way
+  if (width > terminal_width) {
+    qsort(order, giving_way, sizeof(*order), __compare_give_way);
+  }
+
+  for (size_t j = 0; j < giving_way && width > terminal_width; j++) {
+    struct LayoutItem *item = &items[order[j].item];
+    int target = item->width - (width - terminal_width);
+    int min_width = __min_width_of(item, defaults);
+    if (target < min_width) target = min_width;
+    if (target >= item->width) continue;
+
+    int before = item->width;
+    int value_limit = target - (item->width - item->value_width);
+    if (value_limit > 0) {
+      __format_item(item, value_limit, context, defaults, attribute_dict);
+    }
+    else {
+      item->length = item->width = 0; // not even part of it fits
+    }
+    width -= before - item->width;
+  }
+
+  // the @{SPC}s share what's left, the first ones a space more if it
+  // doesn't go evenly
+  if (spaces > 0) {
+    int room = terminal_width - width;
+    size_t nth = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (items[i].id != WIDGET_SPC) continue;
+      int share = room > 0 ? room / (int) spaces + ((int) nth++ < room % (int) spaces) : 0;
+      if (share == 0) continue;
+      const char *filler = spacefiller(share);
+      context->spc = filler;
+      __format_item(&items[i], share, context, defaults, attribute_dict);
+      context->spc = NULL;
+      free((void *) filler);
+      width += items[i].width;
+    }
+  }
+  return width;
+}
+
+
+/**
+ * Helper: Get the program of a prompt, compiling it the first time
+ * it's used; it's then kept with the configuration
+ */
+struct PromptProgram *__get_program(struct PromptProgram **program,
+                                    const char *prompt,
+                                    const struct WidgetConfig *defaults,
+                                    dictionary *attribute_dict) {
+  if (*program == NULL) {
+    *program = __compile_program(prompt, defaults, attribute_dict);
+  }
+  return *program;
+}
+
+
+/**
+ * Helper: Render a prompt program line by line, laying out each line
+ * to fit the terminal with __layout_line().
+ *
+ * @param state       The state gathered for the prompt.
+ * @param base        The widgets known before the expanding ones.
+ * @param rendered    Set to the prompt, each line followed by a newline.
+ * @param last_width  If not NULL, set to the width of the last line.
+ * @return SUCCESS, or ERROR if the prompt is too long or there is no
+ *         memory to lay it out
+ */
+int __render_lines(const struct PromptProgram *program,
+                   struct CurrentState *state,
+                   const struct WidgetContext *base,
+                   const char *cwd_type,
+                   int terminal_width,
+                   struct WidgetConfig *defaults,
+                   dictionary *attribute_dict,
+                   char rendered[PROMPT_MAX_LEN],
+                   int *last_width) {
+  char cwd[PATH_MAX];
+  snprintf(cwd, sizeof(cwd), "%s", get_cwd(state, cwd_type));
+  struct WidgetContext context = *base;
+  context.cwd    = cwd;
+  context.known |= WIDGET_BIT(WIDGET_CWD);
+
+  struct LayoutItem *items = calloc(program->count + 1, sizeof(struct LayoutItem));
+  struct GiveWay *order = calloc(program->count + 1, sizeof(struct GiveWay));
+  size_t length = 0;
+  size_t segment = 0, offset = 0; // where the next line starts
+  rendered[0] = '\0';
+  if (items == NULL || order == NULL) {
+    free(items);
+    free(order);
+    return ERROR;
+  }
+
+  while (segment < program->count) {
+    // split the line into items, measuring each
+    size_t count = 0;
+    int ends = 0, empty = 1;
+    while (segment < program->count && !ends) {
+      const struct PromptSegment *seg = &program->segments[segment];
+      struct LayoutItem *item = &items[count];
+      item->id = seg->id;
+
+      if (seg->id == WIDGET_UNKNOWN) {
+        const char *start = seg->text + offset;
+        const char *newline = memchr(start, '\n', seg->length - offset);
+        item->text   = start;
+        item->length = newline ? (size_t) (newline - start) : seg->length - offset;
+        offset += item->length + (newline != NULL);
+        ends = newline != NULL;
+        if (offset == seg->length) {
+          segment++;
+          offset = 0;
+        }
+        if (item->length == 0) continue;
+        char text[PROMPT_MAX_LEN];
+        snprintf(text, sizeof(text), "%.*s", (int) item->length, start);
+        item->width = count_visible_chars(text);
+      }
+      else if (seg->id == WIDGET_SPC) {
+        item->text   = "";
+        item->length = item->width = 0;
+        segment++;
+      }
+      else {
+        __format_item(item, INT_MAX, &context, defaults, attribute_dict);
+        segment++;
+      }
+      empty &= item->length == 0 && !item->nested && seg->id != WIDGET_CWD && seg->id != WIDGET_SPC;
+      count++;
+    }
+
+    // lines with nothing on them are left out
+    if (!empty) {
+      int width = __layout_line(items, count, order, terminal_width, &context, defaults, attribute_dict);
+      if (last_width) *last_width = width;
+
+      for (size_t i = 0; i < count && length < PROMPT_MAX_LEN; i++) {
+        if (length + items[i].length + 1 >= PROMPT_MAX_LEN) {
+          length = PROMPT_MAX_LEN;
+          break;
+        }
+        memcpy(rendered + length, items[i].text, items[i].length);
+        length += items[i].length;
+      }
+      if (length < PROMPT_MAX_LEN) {
+        rendered[length++] = '\n';
+        rendered[length] = '\0';
+      }
+    }
+    for (size_t i = 0; i < count; i++) {
+      free(items[i].nested);
+      items[i].nested = NULL;
+    }
+    if (length >= PROMPT_MAX_LEN) break;
+  }
+  free(items);
+  free(order);
+  if (length >= PROMPT_MAX_LEN) {
+    rendered[0] = '\0';
+    return ERROR;
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * Helper: The output of render_prompt(): the prompt, written for
+ * the shell, followed by a NUL and the right prompt if there is one.
+ * The caller is responsible for freeing it.
+ *
+ * @param length  Set to the length of the output.
+ * @return the output, or NULL if it couldn't be written
+ */
+char *__join_prompts(enum shell_dialect shell,
+                     struct CurrentState *state,
+                     const char *prompt,
+                     const char *right_prompt,
+                     size_t *length) {
+  char *converted[2] = { NULL, NULL };
+  const char *parts[2] = { prompt, right_prompt };
+  int count = right_prompt ? 2 : 1;
+  if (shell != SHELL_BASH) {
+    struct PromptExpansions expansions = { NULL, NULL, NULL, NULL, 0 };
+    if (shell_dialect_expands(shell)) {
+      expansions.username     = state->username ?: "";
+      expansions.hostname     = state->hostname ?: "";
+      expansions.cwd_home     = get_cwd(state, "home");
+      expansions.cwd_basename = state->cwd_basename;
+      expansions.is_root      = state->uid == 0;
+    }
+    for (int i = 0; i < count; i++) {
+      parts[i] = converted[i] = emit_prompt(shell, parts[i], &expansions);
+    }
+  }
+
+  char *output = NULL;
+  if (parts[0] && (count == 1 || parts[1])) {
+    size_t lengths[2] = { strlen(parts[0]), count == 2 ? strlen(parts[1]) : 0 };
+    *length = lengths[0] + (count == 2 ? 1 + lengths[1] : 0);
+    output = malloc(*length + 1);
+    if (output) {
+      memcpy(output, parts[0], lengths[0] + 1); // and the NUL between them
+      if (count == 2) memcpy(output + lengths[0] + 1, parts[1], lengths[1] + 1);
+    }
+  }
+  free(converted[0]);
+  free(converted[1]);
+  return output;
+}
+
+
+/**
+ * Gather the state of the environment in the requested working
+ * directory, and render the prompt for it.
+ */
+int render_prompt(struct ConfigRoot *config,
+                  enum shell_dialect shell,
+                  const struct RenderRequest *request,
+                  dictionary *attribute_dict,
+                  struct OutputSink *sink) {
+  struct CurrentState state;
+  int retval = SUCCESS;
+
+  /*
+    Let's gather some info on the environment
+  */
+  initialise_state(&state, request->cwd);
+  state.status_threads = config->status_threads;
+  state.exit_status = request->exit_status;
+  state.environment = request->environment;
+  int terminal_width = request->terminal_width;
+  if (config->needs_system_context || shell_dialect_expands(shell)) {
+    gather_system_context(&state); // the latter for \u, \h and \$
+  }
+  // the markers are noted on the walk up to the repository, rather
+  // than by walking up again for each widget
+  if (config->needs_dir_markers < 0) config->needs_dir_markers = __needs_dir_markers(config);
+  state.record_markers = config->needs_dir_markers;
+  gather_git_head_context(&state);
+
+
+  /*
+    .. and figure out which prompt config to select
+
+    There are prompts to choose from:
+    - default: the prompt to use by default AND if the directory is a nascent git repo
+    - git prompt: for use in mature (non-nascent) git repos
+    each with its right prompt, if right prompts are configured
+  */
+  char * selected_cwd_type;
+  const struct CwdShortening *selected_cwd_shortening;
+  struct PromptProgram *program, *right_program = NULL;
+  if (state.is_git_repo != 1 || state.is_nascent_repo == 1) {
+    selected_cwd_type = config->default_prompt_cwd_type;
+    selected_cwd_shortening = &config->default_prompt_cwd_shortening;
+    program = __get_program(&config->default_program, config->default_prompt,
+                            &config->defaults, attribute_dict);
+    if (config->right_prompt) {
+      right_program = __get_program(&config->right_program, config->right_prompt,
+                                    &config->defaults, attribute_dict);
+    }
+  }
+  else {
+    selected_cwd_type = config->git_prompt_cwd_type;
+    selected_cwd_shortening = &config->git_prompt_cwd_shortening;
+    program = __get_program(&config->git_program, config->git_prompt,
+                            &config->defaults, attribute_dict);
+    if (config->git_right_prompt) {
+      right_program = __get_program(&config->git_right_program, config->git_right_prompt,
+                                    &config->defaults, attribute_dict);
+    }
+  }
+
+  // Only pay for libgit2 if a prompt shows the status of the repo
+  if (state.is_git_repo == 1 && state.is_nascent_repo != 1 &&
+      (program->uses_libgit2 || (right_program && right_program->uses_libgit2))) {
+    __gather_repo_status(config, &state);
+  }
+
+  // The AWS token, project markers, kubeconfig and toolchains are
+  // only looked at if they're shown
+  widget_set shown = program->widgets | (right_program ? right_program->widgets : 0);
+  if (shown & WIDGETS_AWS)     gather_aws_context(&state);
+  if (shown & WIDGETS_PROJECT) gather_project_context(&state);
+  if (shown & WIDGETS_K8S)     gather_k8s_context(&state);
+  if (shown & WIDGETS_PYTHON)  gather_python_context(&state);
+  if (shown & WIDGETS_NODE)    gather_node_context(&state);
+  if ((shown & WIDGET_BIT(WIDGET_CMD_DURATION)) && request->command_start > 0) {
+    state.command_duration_ms = __milliseconds_since(request->command_start);
+  }
+
+  // If nothing changed since the last prompt, neither has the prompt
+  uint64_t fingerprint = __render_fingerprint(config, shell, request, &state,
+                                              selected_cwd_shortening);
+  const char *cached_prompt;
+  size_t cached_length;
+  if (render_cache_load(fingerprint, config->render_cache, &cached_prompt, &cached_length) == SUCCESS) {
+    sink_emit(sink, cached_prompt, cached_length);
+    cleanup_resources(&state);
+    return SUCCESS;
+  }
+
+  
+  // Connect states to widgets; the expanding ones are filled in line by line
+  struct WidgetContext context = {
+    .state = &state,
+    .known = WIDGETS_ALL & ~WIDGETS_EXPANDING,
+    .cwd   = NULL,
+    .spc   = NULL,
+    .cwd_shortening = selected_cwd_shortening,
+    .duration_threshold_ms = config->duration_threshold_ms,
+  };
+  char temp_prompt[PROMPT_MAX_LEN];
+  int last_line_width = 0;
+  retval = __render_lines(program, &state, &context, selected_cwd_type, terminal_width,
+                          &config->defaults, attribute_dict, temp_prompt, &last_line_width);
+
+  // The right prompt goes on the last line, so has what's left of it
+  char right_prompt[PROMPT_MAX_LEN] = "";
+  if (right_program && retval == SUCCESS) {
+    retval = __render_lines(right_program, &state, &context, selected_cwd_type,
+                            terminal_width - last_line_width,
+                            &config->defaults, attribute_dict, right_prompt, NULL);
+    size_t right_length = strlen(right_prompt);
+    if (right_length > 0) right_prompt[right_length - 1] = '\0'; // it's one line
+  }
+
+  char *output = NULL;
+  size_t output_length = 0;
+  if (retval == SUCCESS) {
+    output = __join_prompts(shell, &state, temp_prompt, right_program ? right_prompt : NULL, &output_length);
+  }
+  if (output) {
+    render_cache_store(fingerprint, config->render_cache, output, output_length);
+    sink_emit(sink, output, output_length);
+    free(output);
+  }
+  else {
+    const char *too_long = "PROMPT TOO LONG $ ";
+    sink_emit(sink, too_long, strlen(too_long));
+    retval = ERROR;
+  }
+
+  /*
+    Time to free up memory
+  */
+  cleanup_resources(&state);
+  return retval;
+}
+
+
+/**
+ * Release what render_prompt() keeps between prompts.
+ */
+void render_shutdown(void) {
+  render_cache_clear();
+  cwd_shorten_clear_cache();
+  if (libgit2_initialised) {
+    git_libgit2_shutdown();
+    libgit2_initialised = 0;
+  }
+}
@@ -0,0 +1,179 @@
+#ifndef RENDER_H
+#define RENDER_H
+/*
+  header file for render.c
+*/
+#include <stdint.h>
+#include <iniparser/dictionary.h>
+
+#include "colour-depth.h"
+#include "cwd-shorten.h"
+#include "emitters.h"
+#include "output-sink.h"
+
+
+/**
+   Struct to contain configuration for a single widget
+*/
+struct WidgetConfig {
+  char *string_active;
+  char *string_inactive;
+  char *colour_on;
+  char *colour_off;
+  int max_width;
+  int priority;  // when a line doesn't fit, the lowest give way first
+  int min_width; // the narrowest it may be shrunk to, or -1 if it can't be
+
+  // colour_off and colour_on with their attributes rendered, when first used
+  char *colour_codes[2];
+};
+
+/**
+   Struct to contain non-widget configuration
+*/
+struct ConfigRoot {
+  char *              default_prompt;
+  char *              default_prompt_cwd_type;
+  struct CwdShortening default_prompt_cwd_shortening;
+  char *              git_prompt;
+  char *              git_prompt_cwd_type;
+  struct CwdShortening git_prompt_cwd_shortening;
+  char *              right_prompt;     // NULL unless a right prompt is configured
+  char *              git_right_prompt; // likewise
+  struct WidgetConfig defaults;
+
+  // horrid way to ensure to free these if necessary
+  int dynamic_default_prompt;
+  int dynamic_git_prompt;
+  int dynamic_widget_config;
+
+  // [SYSTEM] section
+  int extra_backslash; // 1 = macOS (iniparser 4.2.x interprets \n); 0 = Linux default
+  int status_threads;  // >0 = walk the working tree with this many threads
+  int status_cache_ms; // >0 = share the repo status between shells for this long
+  int duration_threshold_ms; // [Cmd.duration] threshold_ms: it's active from this long
+  enum shell_dialect shell; // what prompt2 writes prompts for
+  enum colour_depth colour_depth; // what the colours are downsampled to
+
+  // 0 once the SYS widgets are compiled into the prompts
+  int needs_system_context;
+  // 1 if the prompts show what the files in the directories above
+  // the cwd tell, 0 if not, -1 until that's known
+  int needs_dir_markers;
+
+  uint64_t stamp;      // fingerprint of the configuration and prompts
+  int render_cache;    // 1 = share rendered prompts between prompt2s
+
+  // the prompts compiled for rendering, when first rendered
+  struct PromptProgram *default_program;
+  struct PromptProgram *git_program;
+  struct PromptProgram *right_program;
+  struct PromptProgram *git_right_program;
+};
+
+
+/**
+ * What a prompt is rendered for.
+ */
+struct RenderRequest {
+  const char *cwd;     // working directory, or NULL for the process' own
+  int terminal_width;  // for CWD and SPC
+  int exit_status;     // of the last command, or -1 if unknown
+  int64_t command_start; // when the last command started, in microseconds since the epoch, or 0 if unknown
+  const char *const *environment; // NAME=value overrides of the process' environment, NULL-terminated, or NULL
+};
+
+
+/**
+ * Load the configuration from an INI file, and check that the
+ * prompts in it are well-formed.
+ *
+ * @param config           The configuration structure to populate.
+ * @param config_file_path The path to the INI file to load. If NULL,
+ *                         a default file is searched for.
+ * @param error            Set to a message to show instead of the
+ *                         prompt, if something goes wrong.
+ * @return SUCCESS, or one of the file related return values or ERROR
+ */
+int load_configuration(struct ConfigRoot *config,
+                       const char *config_file_path,
+                       char *error,
+                       size_t error_size);
+
+
+/**
+ * Free everything load_configuration() allocated.
+ */
+void free_configuration(struct ConfigRoot *config);
+
+
+/**
+ * Partially evaluate the prompts of the configuration: render the
+ * terminal attributes, and the widgets which can't change during a
+ * shell session (the SYS widgets), into them. render_prompt() then
+ * only has the other widgets left to do, and doesn't need to gather
+ * the system context.
+ *
+ * @param config          The configuration to compile.
+ * @param attribute_dict  A dictionary of terminal attribute escape codes.
+ * @return SUCCESS, or FAILURE if the configuration is left as it was
+ */
+int compile_configuration(struct ConfigRoot *config, dictionary *attribute_dict);
+
+
+/**
+ * The prompts of the configuration, as a template for
+ * apply_template(): the default prompt and the git prompt on a line
+ * each, followed by the right prompts if there are any. The caller
+ * is responsible for freeing it.
+ */
+char *configuration_template(const struct ConfigRoot *config);
+
+
+/**
+ * Use the prompts in a template from configuration_template(), such
+ * as a compiled one, instead of those in the configuration.
+ * @return SUCCESS, or FAILURE if it isn't a template
+ */
+int apply_template(struct ConfigRoot *config, const char *template);
+
+
+/**
+ * Check if rendering the prompt needs libgit2, i.e. if the prompt or
+ * any of the widget formats shows the status of the repository.
+ * @return SUCCESS if it does, FAILURE if not
+ */
+int uses_libgit2_widgets(const char *prompt, const struct WidgetConfig *defaults);
+
+
+/**
+ * Gather the state of the environment in the requested working
+ * directory, and render the prompt for it. If the configuration has
+ * right prompts, the right prompt is rendered from the same state,
+ * and follows the prompt in the sink after a NUL.
+ *
+ * @param config          The configuration to render.
+ * @param shell           The shell the prompt is for: usually the
+ *                        configuration's, see emitters.h.
+ * @param request         The directory, terminal width and exit
+ *                        status to render the prompt for.
+ * @param attribute_dict  A dictionary of terminal attribute escape codes.
+ * @param sink            Where the prompt goes - or a message to show
+ *                        instead, if something went wrong.
+ * @return SUCCESS or ERROR
+ */
+int render_prompt(struct ConfigRoot *config,
+                  enum shell_dialect shell,
+                  const struct RenderRequest *request,
+                  dictionary *attribute_dict,
+                  struct OutputSink *sink);
+
+
+/**
+ * Release what render_prompt() keeps between prompts, such as
+ * libgit2.
+ */
+void render_shutdown(void);
+
+
+#endif //RENDER_H
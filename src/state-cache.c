@@ -0,0 +1,295 @@
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
+#endif
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#ifdef __unix__
+#include <linux/limits.h> // For PATH_MAX
+#elif __APPLE__
+#include <sys/syslimits.h> // For PATH_MAX
+#endif
+#include <unistd.h>
+
+#include "constants.h"
+#include "get-status.h"
+#include "state-cache.h"
+
+/*
+  A status cache shared by all prompt2 processes of a user.
+
+  With many shells in the same repo, each prompt would otherwise walk
+  the working tree on its own. Instead, the result of a walk is kept
+  in a small memory-mapped file in $XDG_RUNTIME_DIR, and a prompt
+  drawn shortly after in the same repo reuses it - as long as HEAD,
+  the upstream branch and the index haven't changed.
+
+  There is no daemon and no file locking. Each slot is guarded by a
+  sequence counter (a seqlock): a writer makes the counter odd, writes
+  the slot, and makes it even again. Readers copy the slot and only
+  trust the copy if the counter was even and unchanged across the
+  copy. A writer that finds the slot busy simply doesn't cache -
+  unless it has been busy for longer than any write takes, in which
+  case its writer died halfway, and the slot is taken over rather than
+  left busy for good.
+*/
+
+#define STATUS_CACHE_FILE     "prompt2-status.cache"
+#define STATUS_CACHE_MAGIC    0x32707363 // "csp2"
+#define STATUS_CACHE_VERSION  1
+#define STATUS_CACHE_SLOTS    64
+#define STATUS_CACHE_PROBES   4  // slots to look at for a repo
+#define STATUS_CACHE_PATH_LEN 1024
+#define STATUS_CACHE_STALE_MS 1000 // a slot busy for longer has lost its writer
+
+/**
+ * Everything the cached status depends on, apart from the working
+ * tree itself - which is why entries also expire.
+ */
+struct StatusCacheStamp {
+  git_oid head;
+  git_oid upstream;
+  int64_t index_mtime_sec;
+  int64_t index_mtime_nsec;
+  int64_t index_size;
+  int64_t index_ino;
+};
+
+struct StatusCacheSlot {
+  uint32_t                seq;       // odd while a writer is busy
+  uint32_t                path_hash;
+  int64_t                 written_ms; // set first thing when a writer takes the slot
+  char                    repo_path[STATUS_CACHE_PATH_LEN];
+  struct StatusCacheStamp stamp;
+
+  int32_t staged_num;
+  int32_t modified_num;
+  int32_t untracked_num;
+  int32_t conflict_num;
+  int32_t has_upstream;
+  int32_t ahead_num;
+  int32_t behind_num;
+};
+
+struct StatusCacheFile {
+  uint32_t               magic;
+  uint32_t               version;
+  struct StatusCacheSlot slots[STATUS_CACHE_SLOTS];
+};
+
+
+/**
+ * Helper: Milliseconds since the epoch. The cache is shared between
+ * processes, so this is wall clock time.
+ */
+int64_t __now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return (int64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/**
+ * Helper: FNV-1a hash of the repo path
+ */
+uint32_t __hash_path(const char *path) {
+  uint32_t hash = 2166136261u;
+  for (const unsigned char *p = (const unsigned char *) path; *p; p++) {
+    hash ^= *p;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * Helper: Map the cache file, creating it if needed.
+ * @return the mapping, or NULL if there is no usable cache
+ */
+struct StatusCacheFile *__map_cache_file(void) {
+  const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+  if (runtime_dir == NULL || runtime_dir[0] == '\0') return NULL;
+
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/%s", runtime_dir, STATUS_CACHE_FILE);
+
+  int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0600);
+  if (fd < 0) return NULL;
+
+  // Only trust a file of our own. Growing it fills it with zeroes,
+  // which is a valid, empty cache.
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_uid != getuid() ||
+      (st.st_size < (off_t) sizeof(struct StatusCacheFile) &&
+       ftruncate(fd, sizeof(struct StatusCacheFile)) != 0)) {
+    close(fd);
+    return NULL;
+  }
+
+  struct StatusCacheFile *cache = mmap(NULL, sizeof(struct StatusCacheFile),
+                                       PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (cache == MAP_FAILED) return NULL;
+
+  // Claim a new file, and stay away from one with another layout
+  uint32_t magic = 0;
+  __atomic_compare_exchange_n(&cache->magic, &magic, STATUS_CACHE_MAGIC, 0,
+                              __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+  if (magic == 0) {
+    __atomic_store_n(&cache->version, STATUS_CACHE_VERSION, __ATOMIC_RELEASE);
+  }
+  else if (magic != STATUS_CACHE_MAGIC ||
+           __atomic_load_n(&cache->version, __ATOMIC_ACQUIRE) != STATUS_CACHE_VERSION) {
+    munmap(cache, sizeof(struct StatusCacheFile));
+    return NULL;
+  }
+  return cache;
+}
+
+/**
+ * Helper: Find out what the status of the repo depends on right now
+ * @return SUCCESS or FAILURE
+ */
+int __get_stamp(const struct CurrentState *state, struct StatusCacheStamp *stamp) {
+  if (state->head_oid == NULL || state->git_dir == NULL) return FAILURE;
+  if (strlen(state->repo_path) >= STATUS_CACHE_PATH_LEN) return FAILURE;
+
+  memset(stamp, 0, sizeof(*stamp));
+  stamp->head = *state->head_oid;
+
+  // a missing upstream stays all zeroes
+  char upstream_ref[PATH_MAX];
+  snprintf(upstream_ref, sizeof(upstream_ref), "refs/remotes/origin/%s", state->branch_name);
+  resolve_git_ref(state, upstream_ref, &stamp->upstream);
+
+  char index_path[PATH_MAX];
+  snprintf(index_path, sizeof(index_path), "%s/index", state->git_dir);
+  struct stat st;
+  if (stat(index_path, &st) == 0) {
+#ifdef __APPLE__
+    stamp->index_mtime_sec  = st.st_mtimespec.tv_sec;
+    stamp->index_mtime_nsec = st.st_mtimespec.tv_nsec;
+#else
+    stamp->index_mtime_sec  = st.st_mtim.tv_sec;
+    stamp->index_mtime_nsec = st.st_mtim.tv_nsec;
+#endif
+    stamp->index_size = st.st_size;
+    stamp->index_ino  = st.st_ino;
+  }
+  return SUCCESS;
+}
+
+
+/**
+ * Look up the status of the repo in the shared status cache.
+ */
+int status_cache_load(struct CurrentState *state, int max_age_ms) {
+  struct StatusCacheStamp stamp;
+  if (max_age_ms <= 0 || __get_stamp(state, &stamp) != SUCCESS) return FAILURE;
+
+  struct StatusCacheFile *cache = __map_cache_file();
+  if (cache == NULL) return FAILURE;
+
+  int result = FAILURE;
+  uint32_t hash = __hash_path(state->repo_path);
+  int64_t now = __now_ms();
+
+  for (int i = 0; i < STATUS_CACHE_PROBES; i++) {
+    struct StatusCacheSlot *slot = &cache->slots[(hash + i) % STATUS_CACHE_SLOTS];
+    struct StatusCacheSlot copy;
+
+    uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+    if (seq & 1) continue; // being written
+    memcpy(&copy, slot, sizeof(copy));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq) continue; // torn
+
+    copy.repo_path[STATUS_CACHE_PATH_LEN - 1] = '\0';
+    if (copy.path_hash != hash || strcmp(copy.repo_path, state->repo_path) != 0) continue;
+
+    if (now - copy.written_ms <= max_age_ms && now >= copy.written_ms &&
+        memcmp(&copy.stamp, &stamp, sizeof(stamp)) == 0) {
+      state->staged_num    = copy.staged_num;
+      state->modified_num  = copy.modified_num;
+      state->untracked_num = copy.untracked_num;
+      state->conflict_num  = copy.conflict_num;
+      state->has_upstream  = copy.has_upstream;
+      state->ahead_num     = copy.ahead_num;
+      state->behind_num    = copy.behind_num;
+      result = SUCCESS;
+    }
+    break;
+  }
+
+  munmap(cache, sizeof(struct StatusCacheFile));
+  return result;
+}
+
+
+/**
+ * Save the status of the repo in the shared status cache.
+ */
+int status_cache_store(const struct CurrentState *state) {
+  struct StatusCacheStamp stamp;
+  if (__get_stamp(state, &stamp) != SUCCESS) return FAILURE;
+
+  struct StatusCacheFile *cache = __map_cache_file();
+  if (cache == NULL) return FAILURE;
+
+  // Reuse the repo's slot, otherwise take the oldest one
+  uint32_t hash = __hash_path(state->repo_path);
+  struct StatusCacheSlot *target = NULL;
+  for (int i = 0; i < STATUS_CACHE_PROBES; i++) {
+    struct StatusCacheSlot *slot = &cache->slots[(hash + i) % STATUS_CACHE_SLOTS];
+    if (slot->path_hash == hash &&
+        strncmp(slot->repo_path, state->repo_path, STATUS_CACHE_PATH_LEN) == 0) {
+      target = slot;
+      break;
+    }
+    if (target == NULL || slot->written_ms < target->written_ms) {
+      target = slot;
+    }
+  }
+
+  // Take the slot. If another writer has it, let them have it, unless
+  // they've had it for too long to still be alive.
+  int result = FAILURE;
+  int64_t now = __now_ms();
+  uint32_t seq = __atomic_load_n(&target->seq, __ATOMIC_RELAXED);
+  uint32_t taken = seq + 1;
+  if (seq & 1) {
+    int64_t busy_since = __atomic_load_n(&target->written_ms, __ATOMIC_RELAXED);
+    taken = (now - busy_since > STATUS_CACHE_STALE_MS || now < busy_since) ? seq + 2 : seq;
+  }
+  if (taken != seq &&
+      __atomic_compare_exchange_n(&target->seq, &seq, taken, 0,
+                                  __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+    __atomic_store_n(&target->written_ms, now, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    target->path_hash     = hash;
+    snprintf(target->repo_path, STATUS_CACHE_PATH_LEN, "%s", state->repo_path);
+    target->stamp         = stamp;
+    target->staged_num    = state->staged_num;
+    target->modified_num  = state->modified_num;
+    target->untracked_num = state->untracked_num;
+    target->conflict_num  = state->conflict_num;
+    target->has_upstream  = state->has_upstream;
+    target->ahead_num     = state->ahead_num;
+    target->behind_num    = state->behind_num;
+
+    // if this took so long that the slot was taken over, the new writer
+    // makes it even
+    result = __atomic_compare_exchange_n(&target->seq, &taken, taken + 1, 0,
+                                         __ATOMIC_RELEASE, __ATOMIC_RELAXED) ? SUCCESS : FAILURE;
+  }
+
+  munmap(cache, sizeof(struct StatusCacheFile));
+  return result;
+}
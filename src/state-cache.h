@@ -0,0 +1,30 @@
+#ifndef STATECACHE_H
+#define STATECACHE_H
+/*
+  header file for state-cache.c
+*/
+#include "get-status.h"
+
+
+/**
+ * Look up the status of the repo in the shared status cache, and
+ * copy it into state if it's there, is younger than max_age_ms, and
+ * neither HEAD, the upstream branch nor the index has changed since.
+ *
+ * state must already have the git head context.
+ *
+ * @return SUCCESS on a cache hit, FAILURE otherwise
+ */
+int status_cache_load(struct CurrentState *state, int max_age_ms);
+
+
+/**
+ * Save the status of the repo in the shared status cache, so that
+ * other shells in the same repo can use it.
+ *
+ * @return SUCCESS, or FAILURE if the cache couldn't be written
+ */
+int status_cache_store(const struct CurrentState *state);
+
+
+#endif //STATECACHE_H
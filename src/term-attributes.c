@@ -12,10 +12,17 @@
 
 #include "constants.h"
 #include "attributes.h"
+#include "colour-depth.h"
 #include "prompt2-utils.h"
 #include "term-attributes.h"
 
 
+/**
+   The colour depth attributes are rendered for
+*/
+static enum colour_depth attribute_colour_depth = COLOUR_DEPTH_TRUECOLOR;
+
+
 
 /**
  * Creates and initialises the escape code dictionary
@@ -44,6 +51,13 @@ void free_attribute_dict(dictionary *dict) {
   dictionary_del(dict);
 }
 
+/**
+ * Set the colour depth attributes are downsampled to.
+ */
+void set_attribute_colour_depth(enum colour_depth depth) {
+  attribute_colour_depth = depth;
+}
+
 // TODO: return int, and instead of strdupping the error, use return value to indicate errors/success
 void _join_sequence(char *result, size_t result_size, char *sequences[], size_t count) {
   size_t pos = 0;
@@ -96,7 +110,13 @@ const char * get_attribute_combo(dictionary *attribute_dict, const char* combo)
   int i = 0;
   int error = ATTR_OK;
   while ((token = strtok_r(rest, ",", &rest)) && i < MAX_SEQUENCES) {
-    char *trimmed_token = to_lower((const char*)trim(token));
+    char *untrimmed_token = trim(token);
+    char *trimmed_token = to_lower(untrimmed_token);
+    free(untrimmed_token);
+    if (trimmed_token == NULL) {
+      error = ERROR_IN_ATTR;
+      break;
+    }
 
     // if token starts with 'fg-rgb-' or 'bg-rgb-' then generate
     // the escape code and put that into `sequences`
@@ -146,6 +166,13 @@ const char * get_attribute_combo(dictionary *attribute_dict, const char* combo)
   char combo_result[sizeof(attribute_sequence)+8];
   if (error == ATTR_OK) {
     _join_sequence(attribute_sequence, sizeof(attribute_sequence), sequences, i);
+    if (attribute_colour_depth != COLOUR_DEPTH_TRUECOLOR) {
+      char downsampled[sizeof(attribute_sequence)];
+      if (downsample_sgr(attribute_sequence, attribute_colour_depth,
+                         downsampled, sizeof(downsampled)) == SUCCESS) {
+        strcpy(attribute_sequence, downsampled);
+      }
+    }
     snprintf(combo_result, sizeof(combo_result), "\\[\\e[%sm\\]", attribute_sequence );
   }
   else {
@@ -175,36 +202,54 @@ const char *replace_attribute_tokens(const char *string, dictionary *attribute_d
     char *result = malloc(result_size);
     if (!result) return string; // Failed to allocate memory, return string as-is
 
-    const char *current = string;
+    struct PromptMarkers scan;
+    scan_prompt_markers(string, &scan);
+    size_t position = 0; // in the string, up to where it's been copied
     char *result_ptr = result;
 
-    while (*current) {
-        if (strncmp(current, "%{", 2) == 0) {
-            char *end = strstr(current, "}");
-            if (!end) break; // No closing brace found, break out of the loop
-
-            size_t attr_len = end - current - 2;
-            char *attr = strndup(current + 2, attr_len);
-
-            const char *escape_seq;
-            if (strlen(attr) == 0) {
-              escape_seq = "\\[\\e[0m\\]";
-            }
-            else {
-              escape_seq = get_attribute_combo(attribute_dict, attr) ?: "ERROR";
-            }
-
-            // Copy escape sequence to result
-            strcpy(result_ptr, escape_seq);
-            result_ptr += strlen(escape_seq);
-
-            free(attr);
-            current = end + 1; // Move past the processed token
-        } else {
-            *result_ptr++ = *current++; // Copy current character and move to the next
+    for (size_t i = 0; i < scan.count; i++) {
+        const struct PromptMarker *marker = &scan.markers[i];
+        if (marker->type != MARKER_ATTRIBUTE || marker->offset < position) continue;
+
+        // the token ends at the next '}'
+        size_t close = i + 1;
+        while (close < scan.count && scan.markers[close].type != MARKER_CLOSE) close++;
+        if (close == scan.count) {
+            // No closing brace found, stop copying here
+            scan.length = marker->offset;
+            break;
+        }
+        size_t end = scan.markers[close].offset;
+
+        // Copy the text before the token
+        memcpy(result_ptr, string + position, marker->offset - position);
+        result_ptr += marker->offset - position;
+
+        size_t attr_len = end - marker->offset - 2;
+        char *attr = strndup(string + marker->offset + 2, attr_len);
+
+        const char *escape_seq;
+        if (strlen(attr) == 0) {
+          escape_seq = "\\[\\e[0m\\]";
         }
+        else {
+          escape_seq = get_attribute_combo(attribute_dict, attr) ?: "ERROR";
+        }
+
+        // Copy escape sequence to result
+        strcpy(result_ptr, escape_seq);
+        result_ptr += strlen(escape_seq);
+
+        free(attr);
+        position = end + 1; // Move past the processed token
+        i = close;
     }
 
+    // Copy the text after the last token
+    memcpy(result_ptr, string + position, scan.length - position);
+    result_ptr += scan.length - position;
+    free_prompt_markers(&scan);
+
     *result_ptr = '\0'; // Null-terminate the result string
     return result;
 }
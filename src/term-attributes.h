@@ -3,6 +3,8 @@
 
 #include <iniparser/dictionary.h>
 
+#include "colour-depth.h"
+
 
 /**
  * Creates and initializes the escape code dictionary.
@@ -24,6 +26,14 @@ dictionary *create_attribute_dict();
 void free_attribute_dict(dictionary *dict);
 
 
+/**
+ * Set the colour depth the colours of attributes are downsampled to
+ * by get_attribute_combo(). The default is COLOUR_DEPTH_TRUECOLOR,
+ * which leaves them as they are.
+ */
+void set_attribute_colour_depth(enum colour_depth depth);
+
+
 /**
  * Generates the escape sequence for a given combination of escape
  * codes.
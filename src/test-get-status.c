@@ -18,6 +18,7 @@
 
 #include <git2.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "constants.h"
 #include "get-status.h"
@@ -25,8 +26,17 @@
 int main(void) {
   struct CurrentState state;
 
+  if (lazy_load_libgit2() != SUCCESS) {
+    fprintf(stderr, "Can't load libgit2\n");
+    return 1;
+  }
   git_libgit2_init();
-  initialise_state(&state);
+  initialise_state(&state, NULL);
+
+  // select the parallel status engine, as [SYSTEM] status_threads does for prompt2
+  const char *status_threads = getenv("PROMPT2_STATUS_THREADS");
+  if (status_threads) state.status_threads = atoi(status_threads);
+
   gather_git_context(&state);
 
   const char* cwd_from_gitrepo = get_cwd_from_gitrepo(&state);
@@ -43,6 +53,12 @@ int main(void) {
   printf("Repo.name %s\n",          state.repo_name);
   printf("Repo.branch_name %s\n",   state.branch_name);
   printf("Repo.rebase_active %d\n", state.is_rebase_in_progress);
+  printf("Repo.rebase_step %s\n",   state.rebase_step);
+  printf("Repo.merge_active %d\n",  state.is_merge_in_progress);
+  printf("Repo.cherry_pick_active %d\n", state.is_cherry_pick_in_progress);
+  printf("Repo.revert_active %d\n", state.is_revert_in_progress);
+  printf("Repo.bisect_active %d\n", state.is_bisect_in_progress);
+  printf("Repo.state %s\n",         state.repo_state);
   printf("Repo.conflicts %d\n",     state.conflict_num);
 
   printf("Repo.has_upstream %d\n",  state.has_upstream);
@@ -59,6 +75,21 @@ int main(void) {
   printf("AWS.token_remaining_hours %d\n", state.aws_token_remaining_hours);
   printf("AWS.token_remaining_minutes %d\n", state.aws_token_remaining_minutes);
 
+  gather_project_context(&state);
+  printf("Project.type %s\n",        state.project_type);
+  printf("Project.name %s\n",        state.project_name);
+
+  gather_k8s_context(&state);
+  printf("K8S.context %s\n",         state.k8s_context);
+  printf("K8S.namespace %s\n",       state.k8s_namespace);
+
+  gather_python_context(&state);
+  gather_node_context(&state);
+  printf("Env.venv %s\n",            state.env_venv);
+  printf("Env.conda %s\n",           state.env_conda);
+  printf("Env.python_version %s\n",  state.env_python_version);
+  printf("Env.node_version %s\n",    state.env_node_version);
+
   gather_system_context(&state);
   printf("SYS.username %s\n",         state.username);
   printf("SYS.hostname %s\n",         state.hostname);
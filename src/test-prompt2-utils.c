@@ -7,6 +7,8 @@
 #include <string.h>
 
 #include "constants.h"
+#include "cwd-shorten.h"
+#include "emitters.h"
 #include "prompt2-utils.h"
 
 
@@ -96,6 +98,34 @@ int main(int argc, char *argv[]) {
   }
 
 
+  else if (strcmp(function_name, "bash_to_zsh_prompt") == 0) {
+    if (argc != 3) {
+      fprintf(stderr, "bash_to_zsh_prompt function requires 1 argument.\n");
+      return EXIT_FAILURE;
+    }
+    char *result = bash_to_zsh_prompt(argv[2]);
+    printf("%s\n", result);
+    free(result);
+  }
+
+
+  else if (strcmp(function_name, "emit_prompt") == 0) {
+    if (argc != 4) {
+      fprintf(stderr, "emit_prompt function requires 2 arguments.\n");
+      return EXIT_FAILURE;
+    }
+    enum shell_dialect shell;
+    if (shell_dialect_lookup(argv[2], &shell) != SUCCESS) {
+      fprintf(stderr, "unknown shell '%s'\n", argv[2]);
+      return EXIT_FAILURE;
+    }
+    struct PromptExpansions expansions = { "me", "box", "~/src", "src", 0 };
+    char *result = emit_prompt(shell, argv[3], &expansions);
+    printf("%s\n", result);
+    free(result);
+  }
+
+
   else if (strcmp(function_name, "has_nonexpanding_tokens") == 0) {
     if (argc != 3) {
       fprintf(stderr, "has_nonexpanding_tokens function requires 1 argument.\n");
@@ -133,6 +163,46 @@ int main(int argc, char *argv[]) {
   }
 
 
+  else if (strcmp(function_name, "shorten_cwd") == 0) {
+    if (argc != 6) {
+      fprintf(stderr, "shorten_cwd function requires 4 arguments.\n");
+      return EXIT_FAILURE;
+    }
+    struct CwdShortening how = { CWD_SHORTEN_ELLIPSIS, 2 };
+    if (cwd_shorten_lookup(argv[2], &how.strategy) != SUCCESS) {
+      fprintf(stderr, "unknown way of shortening '%s'\n", argv[2]);
+      return EXIT_FAILURE;
+    }
+    char path[256];
+    snprintf(path, sizeof(path), "%s", argv[3]);
+    shorten_cwd(path, atoi(argv[4]), &how, argv[5]);
+    printf("%s\n", path);
+    cwd_shorten_clear_cache();
+  }
+
+
+  else if (strcmp(function_name, "parse_epoch_realtime") == 0) {
+    if (argc != 3) {
+      fprintf(stderr, "parse_epoch_realtime function requires 1 argument.\n");
+      return EXIT_FAILURE;
+    }
+    const char *end;
+    long long microseconds = parse_epoch_realtime(argv[2], &end);
+    printf("%lld %s\n", microseconds, microseconds ? end : argv[2]);
+  }
+
+
+  else if (strcmp(function_name, "format_duration") == 0) {
+    if (argc != 3) {
+      fprintf(stderr, "format_duration function requires 1 argument.\n");
+      return EXIT_FAILURE;
+    }
+    char duration[32];
+    format_duration(atoll(argv[2]), duration, sizeof(duration));
+    printf("%s\n", duration);
+  }
+
+
   else if (strcmp(function_name, "are_escape_sequences_properly_formed") == 0) {
     if (argc != 3) {
       fprintf(stderr, "are_escape_sequences_properly_formed function requires 1 argument.\n");
@@ -0,0 +1,58 @@
+/*
+ *  test-state-cache.c
+ *
+ *  Usage:
+ *    test-state-cache store <staged> <modified> <untracked>
+ *    test-state-cache load <max_age_ms>
+ *
+ *  Run from inside a git repo. Prints the result in the same format
+ *  as test-get-status.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "get-status.h"
+#include "state-cache.h"
+
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s store <staged> <modified> <untracked>\n", argv[0]);
+    fprintf(stderr, "       %s load <max_age_ms>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  struct CurrentState state;
+  initialise_state(&state, NULL);
+  gather_git_head_context(&state);
+
+  int result;
+  if (strcmp(argv[1], "store") == 0) {
+    if (argc != 5) {
+      fprintf(stderr, "store requires 3 arguments.\n");
+      return EXIT_FAILURE;
+    }
+    state.staged_num    = atoi(argv[2]);
+    state.modified_num  = atoi(argv[3]);
+    state.untracked_num = atoi(argv[4]);
+    result = status_cache_store(&state);
+    printf("Cache.stored %d\n", result == SUCCESS);
+  }
+  else if (strcmp(argv[1], "load") == 0) {
+    result = status_cache_load(&state, atoi(argv[2]));
+    printf("Cache.hit %d\n",          result == SUCCESS);
+    printf("Repo.staged %d\n",        state.staged_num);
+    printf("Repo.modified %d\n",      state.modified_num);
+    printf("Repo.untracked %d\n",     state.untracked_num);
+  }
+  else {
+    fprintf(stderr, "Unknown command '%s'\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  cleanup_resources(&state);
+  return EXIT_SUCCESS;
+}
@@ -40,6 +40,17 @@ int test_get_attribute_combo(char *combo) {
 }
 
 
+int test_get_attribute_combo_at_depth(char *depth_name, char *combo) {
+  enum colour_depth depth;
+  if (colour_depth_lookup(depth_name, &depth) != 0) {
+    fprintf(stderr, "unknown colour depth '%s'\n", depth_name);
+    return 1;
+  }
+  set_attribute_colour_depth(depth);
+  return test_get_attribute_combo(combo);
+}
+
+
 int test_replace_attribute_tokens(char *string) {
   dictionary *dict = create_attribute_dict();
   const char *result = replace_attribute_tokens(string, dict);
@@ -80,6 +91,14 @@ int main(int argc, char *argv[]) {
     return test_get_attribute_combo(argv[2]);
   }
 
+  else if (strcmp(function_name, "get_attribute_combo_at_depth") == 0) {
+    if (argc != 4) {
+      fprintf(stderr, "get_attribute_combo_at_depth function requires 2 arguments.\n");
+      return EXIT_FAILURE;
+    }
+    return test_get_attribute_combo_at_depth(argv[2], argv[3]);
+  }
+
   else if (strcmp(function_name, "replace_attribute_tokens") == 0) {
     if (argc != 3) {
       fprintf(stderr, "replace_attribute_tokens function requires 1 argument.\n");
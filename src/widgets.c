@@ -0,0 +1,267 @@
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include "get-status.h"
+#include "prompt2-utils.h"
+#include "widgets.h"
+
+/*
+  The widget registry.
+
+  Each widget has a descriptor, indexed by its widget_id: its name,
+  where its value is in the CurrentState (and whether it's a string
+  or a number), and when it's active. Prompts refer to widgets by
+  name, which is looked up once, when the prompt is compiled (see
+  render.c); rendering then goes straight to the value.
+*/
+
+/**
+   Where the value of a widget comes from
+*/
+enum widget_source {
+  SOURCE_STRING,     // a const char * in the state
+  SOURCE_CHARS,      // a char array in the state
+  SOURCE_NUMBER,     // an int in the state
+  SOURCE_DURATION,   // an int of milliseconds in the state, -1 if unknown
+  SOURCE_PROMPTCHAR, // '$', or '#' for root
+  SOURCE_CWD,        // the context's cwd
+  SOURCE_SPC,        // the context's filler
+};
+
+struct WidgetDescriptor {
+  const char         *name;          // lower case
+  enum widget_source  source;
+  size_t              offset;        // of the value in struct CurrentState
+  const char         *number_format; // for numbers
+  int               (*is_active)(const char *string, int number);
+};
+
+
+/*
+  Activity predicates
+*/
+static int __active_if_not_empty(const char *string, int number) {
+  (void) number;
+  return string[0] != '\0';
+}
+
+static int __active_if_positive(const char *string, int number) {
+  (void) string;
+  return number > 0;
+}
+
+static int __active_if_not_positive(const char *string, int number) {
+  (void) string;
+  return number <= 0;
+}
+
+static int __active_if_ten_or_less(const char *string, int number) {
+  (void) string;
+  return number <= 10;
+}
+
+// SYS.promptchar and SPC have no inactive state to speak of, and are
+// always shown with their inactive format
+static int __never_active(const char *string, int number) {
+  (void) string;
+  (void) number;
+  return 0;
+}
+
+
+#define STRING_WIDGET(name, field) \
+  { name, SOURCE_STRING, offsetof(struct CurrentState, field), NULL, __active_if_not_empty }
+#define CHARS_WIDGET(name, field) \
+  { name, SOURCE_CHARS,  offsetof(struct CurrentState, field), NULL, __active_if_not_empty }
+#define NUMBER_WIDGET(name, field, format, is_active) \
+  { name, SOURCE_NUMBER, offsetof(struct CurrentState, field), format, is_active }
+#define TOGGLE_WIDGET(name, field) \
+  NUMBER_WIDGET(name, field, "%d", __active_if_positive)
+
+static const struct WidgetDescriptor registry[WIDGET_COUNT] = {
+  [WIDGET_SYS_USERNAME]            = STRING_WIDGET("sys.username",        username),
+  [WIDGET_SYS_HOSTNAME]            = STRING_WIDGET("sys.hostname",        hostname),
+  [WIDGET_SYS_PROMPTCHAR]          = { "sys.promptchar", SOURCE_PROMPTCHAR, 0, NULL, __never_active },
+  [WIDGET_SYS_UID]                 = TOGGLE_WIDGET("sys.uid",             uid),
+  [WIDGET_SYS_GID]                 = TOGGLE_WIDGET("sys.gid",             gid),
+
+  [WIDGET_REPO_IS_GIT_REPO]        = TOGGLE_WIDGET("repo.is_git_repo",    is_git_repo),
+  [WIDGET_REPO_IS_NASCENT_REPO]    = TOGGLE_WIDGET("repo.is_nascent_repo", is_nascent_repo),
+  [WIDGET_REPO_NAME]               = STRING_WIDGET("repo.name",           repo_name),
+  [WIDGET_REPO_BRANCH_NAME]        = STRING_WIDGET("repo.branch_name",    branch_name),
+  [WIDGET_REPO_REBASE_ACTIVE]      = TOGGLE_WIDGET("repo.rebase_active",  is_rebase_in_progress),
+  [WIDGET_REPO_REBASE_STEP]        = CHARS_WIDGET ("repo.rebase_step",    rebase_step),
+  [WIDGET_REPO_MERGE_ACTIVE]       = TOGGLE_WIDGET("repo.merge_active",   is_merge_in_progress),
+  [WIDGET_REPO_CHERRY_PICK_ACTIVE] = TOGGLE_WIDGET("repo.cherry_pick_active", is_cherry_pick_in_progress),
+  [WIDGET_REPO_REVERT_ACTIVE]      = TOGGLE_WIDGET("repo.revert_active",  is_revert_in_progress),
+  [WIDGET_REPO_BISECT_ACTIVE]      = TOGGLE_WIDGET("repo.bisect_active",  is_bisect_in_progress),
+  [WIDGET_REPO_STATE]              = STRING_WIDGET("repo.state",          repo_state),
+  [WIDGET_REPO_CONFLICTS]          = TOGGLE_WIDGET("repo.conflicts",      conflict_num),
+  [WIDGET_REPO_HAS_UPSTREAM]       = TOGGLE_WIDGET("repo.has_upstream",   has_upstream),
+  [WIDGET_REPO_AHEAD]              = TOGGLE_WIDGET("repo.ahead",          ahead_num),
+  [WIDGET_REPO_BEHIND]             = TOGGLE_WIDGET("repo.behind",         behind_num),
+  [WIDGET_REPO_STAGED]             = TOGGLE_WIDGET("repo.staged",         staged_num),
+  [WIDGET_REPO_MODIFIED]           = TOGGLE_WIDGET("repo.modified",       modified_num),
+  [WIDGET_REPO_UNTRACKED]          = TOGGLE_WIDGET("repo.untracked",      untracked_num),
+
+  [WIDGET_AWS_TOKEN_IS_VALID]          = TOGGLE_WIDGET("aws.token_is_valid", aws_token_is_valid),
+  [WIDGET_AWS_TOKEN_REMAINING_HOURS]   = NUMBER_WIDGET("aws.token_remaining_hours",
+                                                       aws_token_remaining_hours,
+                                                       "%d", __active_if_not_positive),
+  [WIDGET_AWS_TOKEN_REMAINING_MINUTES] = NUMBER_WIDGET("aws.token_remaining_minutes",
+                                                       aws_token_remaining_minutes,
+                                                       "%02d", __active_if_ten_or_less),
+
+  [WIDGET_PROJECT_TYPE]            = STRING_WIDGET("project.type",        project_type),
+  [WIDGET_PROJECT_NAME]            = STRING_WIDGET("project.name",        project_name),
+
+  [WIDGET_K8S_CONTEXT]             = CHARS_WIDGET ("k8s.context",         k8s_context),
+  [WIDGET_K8S_NAMESPACE]           = CHARS_WIDGET ("k8s.namespace",       k8s_namespace),
+
+  [WIDGET_ENV_VENV]                = CHARS_WIDGET ("env.venv",            env_venv),
+  [WIDGET_ENV_CONDA]               = CHARS_WIDGET ("env.conda",           env_conda),
+  [WIDGET_ENV_PYTHON_VERSION]      = CHARS_WIDGET ("env.python_version",  env_python_version),
+  [WIDGET_ENV_NODE_VERSION]        = CHARS_WIDGET ("env.node_version",    env_node_version),
+
+  // active from the context's duration_threshold_ms
+  [WIDGET_CMD_DURATION]            = { "cmd.duration", SOURCE_DURATION,
+                                       offsetof(struct CurrentState, command_duration_ms), NULL, NULL },
+  [WIDGET_CMD_EXIT_STATUS]         = TOGGLE_WIDGET("cmd.exit_status",     exit_status),
+
+  [WIDGET_CWD]                     = { "cwd", SOURCE_CWD, 0, NULL, __active_if_not_empty },
+  [WIDGET_SPC]                     = { "spc", SOURCE_SPC, 0, NULL, __never_active },
+};
+
+
+/**
+   The registry's names, hashed case-insensitively into an
+   open-addressed table (of widget_id + 1, 0 for an empty slot), so a
+   name is looked up without case folding it into a copy first
+*/
+#define LOOKUP_TABLE_SIZE 128 // a power of two, well above WIDGET_COUNT
+static unsigned char lookup_table[LOOKUP_TABLE_SIZE];
+static uint32_t      name_hashes[WIDGET_COUNT];
+static int           lookup_table_built = 0;
+
+/**
+ * Helper: FNV-1a hash of a name, ignoring case
+ */
+uint32_t __name_hash(const char *name, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (unsigned char) tolower((unsigned char) name[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * Helper: Hash every name in the registry into the lookup table
+ */
+void __build_lookup_table(void) {
+  for (int id = 0; id < WIDGET_COUNT; id++) {
+    name_hashes[id] = __name_hash(registry[id].name, strlen(registry[id].name));
+    size_t slot = name_hashes[id] & (LOOKUP_TABLE_SIZE - 1);
+    while (lookup_table[slot]) slot = (slot + 1) & (LOOKUP_TABLE_SIZE - 1);
+    lookup_table[slot] = (unsigned char) (id + 1);
+  }
+  lookup_table_built = 1;
+}
+
+
+/**
+ * Look up a widget by its name, ignoring case.
+ */
+enum widget_id widget_lookup(const char *name, size_t length) {
+  if (!lookup_table_built) __build_lookup_table();
+
+  uint32_t hash = __name_hash(name, length);
+  for (size_t slot = hash & (LOOKUP_TABLE_SIZE - 1);
+       lookup_table[slot];
+       slot = (slot + 1) & (LOOKUP_TABLE_SIZE - 1)) {
+    int id = lookup_table[slot] - 1;
+    if (name_hashes[id] == hash &&
+        strncasecmp(name, registry[id].name, length) == 0 && registry[id].name[length] == '\0') {
+      return (enum widget_id) id;
+    }
+  }
+  return WIDGET_UNKNOWN;
+}
+
+
+/**
+ * The name of a widget, in lower case.
+ */
+const char *widget_name(enum widget_id id) {
+  return registry[id].name;
+}
+
+
+/**
+ * Helper: The string value of a widget, or NULL for a number widget
+ */
+const char *__widget_string(const struct WidgetDescriptor *widget,
+                            const struct WidgetContext *context) {
+  const char *state = (const char *) context->state;
+  const char *string;
+
+  switch (widget->source) {
+  case SOURCE_STRING:     string = *(const char * const *) (state + widget->offset); break;
+  case SOURCE_CHARS:      string = state + widget->offset; break;
+  case SOURCE_PROMPTCHAR: string = context->state->uid ? "$" : "#"; break;
+  case SOURCE_CWD:        string = context->cwd; break;
+  case SOURCE_SPC:        string = context->spc; break;
+  default:                return NULL;
+  }
+  return string ? string : "";
+}
+
+/**
+ * Helper: The number value of a number widget
+ */
+int __widget_number(const struct WidgetDescriptor *widget,
+                    const struct WidgetContext *context) {
+  return *(const int *) ((const char *) context->state + widget->offset);
+}
+
+
+/**
+ * The text a widget shows for the context.
+ */
+const char *widget_value(enum widget_id id,
+                         const struct WidgetContext *context,
+                         char *buffer,
+                         size_t buffer_size) {
+  const struct WidgetDescriptor *widget = &registry[id];
+  if (widget->source == SOURCE_DURATION) {
+    int duration = __widget_number(widget, context);
+    if (duration < 0) return "";
+    format_duration(duration, buffer, buffer_size);
+    return buffer;
+  }
+  if (widget->source != SOURCE_NUMBER) {
+    return __widget_string(widget, context);
+  }
+  snprintf(buffer, buffer_size, widget->number_format, __widget_number(widget, context));
+  return buffer;
+}
+
+
+/**
+ * Whether a widget is active for the context.
+ */
+int widget_is_active(enum widget_id id, const struct WidgetContext *context) {
+  const struct WidgetDescriptor *widget = &registry[id];
+  if (widget->source == SOURCE_DURATION) {
+    int duration = __widget_number(widget, context);
+    return duration >= 0 && duration >= context->duration_threshold_ms;
+  }
+  if (widget->source != SOURCE_NUMBER) {
+    return widget->is_active(__widget_string(widget, context), 0);
+  }
+  return widget->is_active(NULL, __widget_number(widget, context));
+}
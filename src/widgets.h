@@ -0,0 +1,136 @@
+#ifndef WIDGETS_H
+#define WIDGETS_H
+/*
+  header file for widgets.c
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cwd-shorten.h"
+#include "get-status.h"
+
+
+/**
+ * Every widget prompt2 knows, as an index into the widget registry.
+ */
+enum widget_id {
+  WIDGET_UNKNOWN = -1,
+
+  WIDGET_SYS_USERNAME = 0,
+  WIDGET_SYS_HOSTNAME,
+  WIDGET_SYS_PROMPTCHAR,
+  WIDGET_SYS_UID,
+  WIDGET_SYS_GID,
+
+  WIDGET_REPO_IS_GIT_REPO,
+  WIDGET_REPO_IS_NASCENT_REPO,
+  WIDGET_REPO_NAME,
+  WIDGET_REPO_BRANCH_NAME,
+  WIDGET_REPO_REBASE_ACTIVE,
+  WIDGET_REPO_REBASE_STEP,
+  WIDGET_REPO_MERGE_ACTIVE,
+  WIDGET_REPO_CHERRY_PICK_ACTIVE,
+  WIDGET_REPO_REVERT_ACTIVE,
+  WIDGET_REPO_BISECT_ACTIVE,
+  WIDGET_REPO_STATE,
+  WIDGET_REPO_CONFLICTS,
+  WIDGET_REPO_HAS_UPSTREAM,
+  WIDGET_REPO_AHEAD,
+  WIDGET_REPO_BEHIND,
+  WIDGET_REPO_STAGED,
+  WIDGET_REPO_MODIFIED,
+  WIDGET_REPO_UNTRACKED,
+
+  WIDGET_AWS_TOKEN_IS_VALID,
+  WIDGET_AWS_TOKEN_REMAINING_HOURS,
+  WIDGET_AWS_TOKEN_REMAINING_MINUTES,
+
+  WIDGET_PROJECT_TYPE,
+  WIDGET_PROJECT_NAME,
+
+  WIDGET_K8S_CONTEXT,
+  WIDGET_K8S_NAMESPACE,
+
+  WIDGET_ENV_VENV,
+  WIDGET_ENV_CONDA,
+  WIDGET_ENV_PYTHON_VERSION,
+  WIDGET_ENV_NODE_VERSION,
+
+  WIDGET_CMD_DURATION,
+  WIDGET_CMD_EXIT_STATUS,
+
+  // the expanding widgets, filled in line by line
+  WIDGET_CWD,
+  WIDGET_SPC,
+
+  WIDGET_COUNT
+};
+
+/**
+   A set of widgets, with a bit for each widget_id
+*/
+typedef uint64_t widget_set;
+#define WIDGET_BIT(id)   ((widget_set) 1 << (id))
+#define WIDGETS_ALL      (WIDGET_BIT(WIDGET_COUNT) - 1)
+#define WIDGETS_SYSTEM   (WIDGET_BIT(WIDGET_SYS_USERNAME) | WIDGET_BIT(WIDGET_SYS_HOSTNAME) | \
+                          WIDGET_BIT(WIDGET_SYS_PROMPTCHAR) | WIDGET_BIT(WIDGET_SYS_UID) | \
+                          WIDGET_BIT(WIDGET_SYS_GID))
+#define WIDGETS_PROJECT  (WIDGET_BIT(WIDGET_PROJECT_TYPE) | WIDGET_BIT(WIDGET_PROJECT_NAME))
+#define WIDGETS_AWS      (WIDGET_BIT(WIDGET_AWS_TOKEN_IS_VALID) | \
+                          WIDGET_BIT(WIDGET_AWS_TOKEN_REMAINING_HOURS) | \
+                          WIDGET_BIT(WIDGET_AWS_TOKEN_REMAINING_MINUTES))
+#define WIDGETS_K8S      (WIDGET_BIT(WIDGET_K8S_CONTEXT) | WIDGET_BIT(WIDGET_K8S_NAMESPACE))
+#define WIDGETS_PYTHON   (WIDGET_BIT(WIDGET_ENV_VENV) | WIDGET_BIT(WIDGET_ENV_CONDA) | \
+                          WIDGET_BIT(WIDGET_ENV_PYTHON_VERSION))
+#define WIDGETS_NODE     WIDGET_BIT(WIDGET_ENV_NODE_VERSION)
+#define WIDGETS_EXPANDING (WIDGET_BIT(WIDGET_CWD) | WIDGET_BIT(WIDGET_SPC))
+
+
+/**
+ * What a widget shows, and whether it is active, is worked out from
+ * the state and, for the expanding widgets, from these.
+ */
+struct WidgetContext {
+  const struct CurrentState *state;
+  widget_set  known; // the widgets whose values are known; others are left as tokens
+  const char *cwd;   // the (shortened) working directory, for @{CWD}
+  const struct CwdShortening *cwd_shortening; // how @{CWD} is shortened to fit
+  const char *spc;   // the filler, for @{SPC}
+  int duration_threshold_ms; // @{Cmd.duration} is active from this long
+};
+
+
+/**
+ * Look up a widget by its name, ignoring case, e.g. "Repo.name".
+ * @param length  the length of the name
+ * @return its widget_id, or WIDGET_UNKNOWN
+ */
+enum widget_id widget_lookup(const char *name, size_t length);
+
+
+/**
+ * The name of a widget, in lower case, e.g. "repo.name".
+ */
+const char *widget_name(enum widget_id id);
+
+
+/**
+ * The text a widget shows for the context: a string widget's string,
+ * or a number widget's number written into buffer.
+ * @return the text, which is either in buffer or in the state
+ */
+const char *widget_value(enum widget_id id,
+                         const struct WidgetContext *context,
+                         char *buffer,
+                         size_t buffer_size);
+
+
+/**
+ * Whether a widget is active for the context, e.g. a string widget
+ * with a non-empty string, or a number widget above zero.
+ * @return 1 if active, 0 if inactive
+ */
+int widget_is_active(enum widget_id id, const struct WidgetContext *context);
+
+
+#endif //WIDGETS_H
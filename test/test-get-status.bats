@@ -303,6 +303,29 @@ load test_helper_functions
   assert Repo.branch_name 'featureBranch'
 }
 
+# --------------------------------------------------
+@test "linked worktree with packed refs" {
+  # given we have a git repo with its refs packed
+  helper__new_repo_and_commit "newfile" "some text"
+  git branch featureBranch
+  git pack-refs --all
+
+  # given we enter a linked worktree of the repo, where .git is a file
+  git worktree add ../myWorktree featureBranch
+  cd ../myWorktree
+
+  # when we run the prompt lib
+  run -0 $TEST_FUNCTION
+
+  # then the repo and branch should be read through the worktree
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.is_git_repo     1
+  assert Repo.is_nascent_repo 0
+  assert Repo.name            'myWorktree'
+  assert Repo.branch_name     'featureBranch'
+  assert CWD.git_path         '+/'
+}
+
 # --------------------------------------------------
 @test "cloning a repo and entering it" {
   # given we have a git repo
@@ -659,6 +682,248 @@ load test_helper_functions
   assert Repo.staged        '0'
   assert Repo.conflicts      '0'
   assert Repo.rebase_active '1'
+  assert Repo.rebase_step   '1/1'
+  assert Repo.state         'REBASE-i'
+}
+
+# --------------------------------------------------
+@test "cherry-pick with a conflict" {
+  # given we have a repo with two branches changing the same line
+  helper__new_repo_and_commit "newfile" "some text"
+  git checkout -b otherBranch
+  echo "other text" > newfile
+  git commit -a -m 'change on other branch'
+  git checkout "$DEFAULT_GIT_BRANCH_NAME"
+  echo "main text" > newfile
+  git commit -a -m 'change on main'
+
+  # when we cherry-pick the change from the other branch
+  run ! git cherry-pick otherBranch
+
+  run -0 $TEST_FUNCTION
+
+  # then the cherry-pick should be in progress, but not a merge
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.cherry_pick_active '1'
+  assert Repo.merge_active       '0'
+  assert Repo.rebase_active      '0'
+  assert Repo.state              'CHERRY-PICKING'
+}
+
+# --------------------------------------------------
+@test "bisecting" {
+  # given we have a repo with a few commits
+  helper__new_repo_and_commit "newfile" "some text"
+  echo "hello" > newfile
+  git commit -a -m '2nd commit'
+
+  # when we start bisecting
+  git bisect start HEAD HEAD^1
+
+  run -0 $TEST_FUNCTION
+
+  # then the bisect should be in progress
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.bisect_active '1'
+  assert Repo.state         'BISECTING'
+}
+
+# --------------------------------------------------
+@test "parallel status engine agrees with libgit2" {
+  # given we have a repo with files in a few directories
+  helper__new_repo
+  echo assert-file >> .git/info/exclude  # the first run's output mustn't count as untracked
+  mkdir a b
+  echo one   > a/one
+  echo two   > a/two
+  echo three > b/three
+  echo root  > root.txt
+  echo '*.log' > .gitignore
+  git add .
+  git commit -m 'Initial commit'
+
+  # .. and we modify one file and delete another
+  echo changed > a/one
+  rm b/three
+
+  # .. stage a new file in a new directory
+  mkdir c
+  echo staged > c/staged
+  git add c/staged
+
+  # .. and create untracked and ignored files
+  mkdir d e
+  touch root-new d/file a/new
+  touch x.log e/only.log
+
+  # when we run the prompt lib with the default and the parallel engine
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.staged    '1'
+  assert Repo.modified  '2'
+  assert Repo.untracked '3'
+
+  PROMPT2_STATUS_THREADS=4 run -0 $TEST_FUNCTION
+
+  # then both should count the same
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.staged    '1'
+  assert Repo.modified  '2'
+  assert Repo.untracked '3'
+}
+
+# --------------------------------------------------
+@test "parallel status engine counts a directory which replaced a tracked file" {
+  # given we have a repo with a file in the root and one in a directory
+  helper__new_repo
+  echo assert-file >> .git/info/exclude  # the first run's output mustn't count as untracked
+  mkdir a
+  echo one > a/one
+  echo top > top
+  git add .
+  git commit -m 'Initial commit'
+
+  # .. and we replace both files with directories
+  rm top a/one
+  mkdir top a/one
+  touch top/inner a/one/inner
+
+  # when we run the prompt lib with the default and the parallel engine
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified  '2'
+  assert Repo.untracked '2'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+
+  # then both should count the files as modified and the directories as untracked
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified  '2'
+  assert Repo.untracked '2'
+}
+
+# --------------------------------------------------
+@test "parallel status engine honours core.filemode" {
+  # given we have a repo which doesn't track the executable bit
+  helper__new_repo
+  mkdir a
+  echo one  > a/one
+  echo root > root.txt
+  git add .
+  git commit -m 'Initial commit'
+  git config core.filemode false
+
+  # .. and we make the files executable
+  chmod +x a/one root.txt
+
+  # when we run the prompt lib with the default and the parallel engine
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+
+  # then neither should count them as modified
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+}
+
+# --------------------------------------------------
+@test "parallel status engine sees a rewrite which kept the size and mtime" {
+  # given we have a repo with two files
+  helper__new_repo
+  mkdir a
+  echo one  > a/one
+  echo root > root.txt
+  git add .
+  git commit -m 'Initial commit'
+
+  # .. and we change both to the same size, putting their mtimes back
+  sleep 0.1
+  touch -r a/one a/one.mtime
+  touch -r root.txt root.mtime
+  echo ONE  > a/one
+  echo ROOT > root.txt
+  touch -r a/one.mtime a/one
+  touch -r root.mtime root.txt
+  rm a/one.mtime root.mtime
+
+  # when we run the prompt lib with the default and the parallel engine
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '2'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+
+  # then both should count them as modified, by their ctimes
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '2'
+}
+
+# --------------------------------------------------
+@test "parallel status engine skips assume-unchanged and skip-worktree files" {
+  # given we have a repo with two files
+  helper__new_repo
+  mkdir a
+  echo one  > a/one
+  echo root > root.txt
+  git add .
+  git commit -m 'Initial commit'
+
+  # .. and we change both, after marking them as unchanged
+  git update-index --skip-worktree a/one
+  git update-index --assume-unchanged root.txt
+  echo changed > a/one
+  echo changed > root.txt
+
+  # when we run the prompt lib with the default and the parallel engine
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+
+  # then neither should count them as modified
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+}
+
+# --------------------------------------------------
+@test "parallel status engine counts a dirty submodule" {
+  # given we have a repo to use as a submodule
+  mkdir sub
+  cd sub
+  helper__new_repo_and_commit 'file' 'content'
+  cd ..
+
+  # .. and a repo which has it as a submodule
+  mkdir super
+  cd super
+  helper__new_repo_and_commit 'root.txt' 'root'
+  git -c protocol.file.allow=always submodule add "$HOME/sub" lib/sub
+  git commit -m 'Add submodule'
+
+  # when we run the prompt lib on the clean submodule
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '0'
+
+  # .. and after changing a file inside it
+  echo changed > lib/sub/file
+
+  run -0 $TEST_FUNCTION
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '1'
+
+  PROMPT2_STATUS_THREADS=3 run -0 $TEST_FUNCTION
+
+  # then both should count it as modified
+  echo "$output" > "$HOME/assert-file"
+  assert Repo.modified '1'
 }
 
 # --------------------------------------------------
@@ -740,3 +1005,203 @@ load test_helper_functions
   assert AWS.token_remaining_minutes '15' \
     || assert AWS.token_remaining_minutes '14'
 }
+
+# --------------------------------------------------
+@test "a project marker above . gives the project" {
+  # given a project with two markers, and we're deep inside it
+  mkdir -p myProject/src/deep
+  touch myProject/Cargo.toml myProject/.tool-versions
+  cd myProject/src/deep
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then the nearest marker gives the project, and of its markers,
+  # Cargo.toml is preferred over .tool-versions
+  echo "$output" > "$HOME/assert-file"
+  assert Project.type 'rust'
+  assert Project.name 'myProject'
+}
+
+# --------------------------------------------------
+@test "a .terraform file isn't a project marker" {
+  # given a .terraform which is a file, and one which is a directory
+  mkdir -p infra/.terraform infra/module
+  touch infra/module/.terraform
+  cd infra/module
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then only the directory counts
+  echo "$output" > "$HOME/assert-file"
+  assert Project.type 'terraform'
+  assert Project.name 'infra'
+}
+
+# --------------------------------------------------
+@test "the project search stops at the root of a git repo" {
+  # given a marker above a git repo
+  touch package.json
+  mkdir myRepo
+  cd myRepo
+  helper__new_repo_and_commit "newfile" "some text"
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then it isn't found
+  echo "$output" > "$HOME/assert-file"
+  assert Project.type ''
+  assert Project.name ''
+}
+
+# --------------------------------------------------
+@test "the current kubernetes context and its namespace" {
+  # given a kubeconfig as kubectl writes it, with a list inside the
+  # current context
+  unset KUBECONFIG
+  mkdir -p $HOME/.kube
+  cat<<-EOF>$HOME/.kube/config
+	apiVersion: v1
+	contexts:
+	- context:
+	    cluster: minikube
+	    extensions:
+	    - extension:
+	        provider: minikube.sigs.k8s.io
+	      name: context_info
+	    namespace: "kube-system"
+	  name: minikube
+	- context:
+	    cluster: prod
+	  name: prod
+	current-context: minikube
+	kind: Config
+	EOF
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then
+  echo "$output" > "$HOME/assert-file"
+  assert K8S.context   'minikube'
+  assert K8S.namespace 'kube-system'
+}
+
+# --------------------------------------------------
+@test "KUBECONFIG with several files is merged as kubectl does" {
+  # given two kubeconfigs: the first sets the context, the second
+  # sets the current-context, and defines the context again
+  cat<<-EOF>$HOME/first.yaml
+	contexts:
+	- name: prod
+	  context:
+	    cluster: prod
+	EOF
+  cat<<-EOF>$HOME/second.yaml
+	current-context: 'prod' # the second file's
+	contexts:
+	- context:
+	    namespace: ignored
+	  name: prod
+	EOF
+  export KUBECONFIG="$HOME/first.yaml:$HOME/missing.yaml:$HOME/second.yaml"
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then the first definition of the context wins, and without a
+  # namespace it's the default one
+  echo "$output" > "$HOME/assert-file"
+  assert K8S.context   'prod'
+  assert K8S.namespace 'default'
+}
+
+# --------------------------------------------------
+@test "the python version of a virtualenv" {
+  # given an active virtualenv, made with a prompt
+  mkdir -p $HOME/venvs/myenv
+  cat<<-EOF>$HOME/venvs/myenv/pyvenv.cfg
+	home = /usr/bin
+	include-system-site-packages = false
+	version_info = 3.12.1.final.0
+	prompt = 'myproject'
+	EOF
+  export VIRTUAL_ENV=$HOME/venvs/myenv
+  unset CONDA_DEFAULT_ENV CONDA_PREFIX
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then both come from its pyvenv.cfg
+  echo "$output" > "$HOME/assert-file"
+  assert Env.venv           'myproject'
+  assert Env.conda          ''
+  assert Env.python_version '3.12.1'
+}
+
+# --------------------------------------------------
+@test "the python version of a conda environment" {
+  # given an active conda environment with python installed in it
+  mkdir -p $HOME/conda/envs/science/conda-meta
+  touch $HOME/conda/envs/science/conda-meta/pip-23.3.1-py310h06a4308_0.json
+  touch $HOME/conda/envs/science/conda-meta/python-3.10.13-h955ad1f_0.json
+  export CONDA_DEFAULT_ENV=science CONDA_PREFIX=$HOME/conda/envs/science
+  unset VIRTUAL_ENV
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then the version comes from the name of the python package
+  echo "$output" > "$HOME/assert-file"
+  assert Env.venv           ''
+  assert Env.conda          'science'
+  assert Env.python_version '3.10.13'
+}
+
+# --------------------------------------------------
+@test "the versions pinned by .python-version and .nvmrc" {
+  # given a project pinning its versions, and we're inside it
+  mkdir -p myProject/src
+  echo '3.9.18' > myProject/.python-version
+  echo 'v18.19.0' > myProject/.nvmrc
+  cd myProject/src
+  unset VIRTUAL_ENV CONDA_DEFAULT_ENV CONDA_PREFIX PYENV_VERSION
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then the nearest pins give the versions
+  echo "$output" > "$HOME/assert-file"
+  assert Env.python_version '3.9.18'
+  assert Env.node_version   '18.19.0'
+}
+
+# --------------------------------------------------
+@test "the versions of the python and node in PATH" {
+  # given a python3 which links to python3.12, and a node installed
+  # with its headers
+  mkdir -p $HOME/py/bin $HOME/node/bin $HOME/node/include/node
+  printf '#!/bin/sh\n' > $HOME/py/bin/python3.12
+  ln -s python3.12 $HOME/py/bin/python3
+  printf '#!/bin/sh\n' > $HOME/node/bin/node
+  chmod +x $HOME/py/bin/python3.12 $HOME/node/bin/node
+  cat<<-EOF>$HOME/node/include/node/node_version.h
+	#ifndef SRC_NODE_VERSION_H_
+	#define SRC_NODE_VERSION_H_
+	#define NODE_MAJOR_VERSION 20
+	#define NODE_MINOR_VERSION 11
+	#define NODE_PATCH_VERSION 0
+	EOF
+  export PATH="$HOME/py/bin:$HOME/node/bin:$PATH" PYENV_ROOT=$HOME/.pyenv
+  unset VIRTUAL_ENV CONDA_DEFAULT_ENV CONDA_PREFIX PYENV_VERSION
+
+  # when we run the test lib
+  run -0 $TEST_FUNCTION
+
+  # then the versions are read from the install, without running them
+  echo "$output" > "$HOME/assert-file"
+  assert Env.python_version '3.12'
+  assert Env.node_version   '20.11.0'
+}
@@ -186,6 +186,19 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   test "$output" = ""
 }
 
+# --------------------------------------------------
+@test "truncate_with_ellipsis() counts columns, not bytes" {
+  # Given a string of two column wide emoji, which are four bytes each
+  string='🐙🐳🐠🐡🦀'
+
+  # When we limit it to 7 columns
+  run -0 $TEST_FUNCTION truncate_with_ellipsis "$string" 7
+
+  # Then
+  # - two emoji fit before the ellipsis
+  test "$output" = '🐙🐳...'
+}
+
 # --------------------------------------------------
 @test "replace_literal_newline() replaces \n with a newline correctly" {
   # Given a string with a newline sequence in it
@@ -210,6 +223,58 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   test "$output" = 'no-newlines'
 }
 
+# --------------------------------------------------
+@test "bash_to_zsh_prompt() converts escapes and quotes percent signs" {
+  # Given a bash prompt with escape sequences, a % and a \W
+  string='\[\e[1m\]50%\[\e[0m\] \W\$ '
+
+  # When we test
+  run -0 $TEST_FUNCTION bash_to_zsh_prompt "$string"
+
+  # Then
+  # - bash escapes become zsh ones and the % is doubled
+  test "$output" = $'%{\e[1m%}50%%%{\e[0m%} %1~%# '
+}
+
+# --------------------------------------------------
+@test "bash_to_zsh_prompt() passes through unknown escapes" {
+  # Given a bash-only escape with no zsh equivalent
+  string='\j jobs \\ done'
+
+  # When we test
+  run -0 $TEST_FUNCTION bash_to_zsh_prompt "$string"
+
+  # Then
+  # - the unknown escape is left alone and \\ is a backslash
+  test "$output" = '\j jobs \ done'
+}
+
+# --------------------------------------------------
+@test "emit_prompt() writes raw escapes and fills in the prompt escapes for fish" {
+  # Given a bash prompt with escape sequences and prompt escapes
+  string='\[\e[1m\]\u@\h:\w\[\033[0m\] \W \$ '
+
+  # When we test
+  # (the test driver says the user is "me" on "box", in ~/src)
+  run -0 $TEST_FUNCTION emit_prompt fish "$string"
+
+  # Then
+  # - there are no markers around the escape sequences
+  test "$output" = $'\e[1mme@box:~/src\e[0m src $ '
+}
+
+# --------------------------------------------------
+@test "emit_prompt() writes colours as tmux styles, and quotes #" {
+  # Given a bash prompt with colours, and a #
+  string='\[\e[1;38;5;208m\]#1\[\e[0m\] \[\e[48;2;255;0;16;93m\]x'
+
+  # When we test
+  run -0 $TEST_FUNCTION emit_prompt tmux "$string"
+
+  # Then
+  test "$output" = '#[bold,fg=colour208]##1#[default] #[bg=#ff0010,fg=brightyellow]x'
+}
+
 # --------------------------------------------------
 @test "has_nonexpanding_tokens() returns true (widget at start)" {
   # Given a string with a widget in in
@@ -329,6 +394,33 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   test $output = '...ive/six'
 }
 
+# --------------------------------------------------
+@test "shorten_path() counts wide characters, and doesn't split them" {
+  # Given a long path with two column wide characters in it
+  string='/projects/日本語/ドキュメント'
+
+  # When we shorten it to 12 columns
+  run -0 $TEST_FUNCTION shorten_path "$string" 12
+
+  # Then
+  # - what's left after the ellipsis is the last four characters, 8
+  #   columns, as a fifth wouldn't fit in the 9 columns left
+  test "$output" = '...ュメント'
+}
+
+# --------------------------------------------------
+@test "shorten_path() is right when the path is just too long" {
+  # Given a path one character longer than the limit
+  string='/one/two/three'
+
+  # When we test 
+  run -0 $TEST_FUNCTION shorten_path $string 13
+
+  # Then
+  # - it should be 13 characters long, with the ellipsis
+  test $output = '.../two/three'
+}
+
 # --------------------------------------------------
 @test "shorten_path() shortens correctly (limit < 4)" {
   skip "These should return the empty string, but doesn't FIXME"
@@ -346,6 +438,56 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   done
 }
 
+# --------------------------------------------------
+@test "shorten_cwd() cuts directories down to their first letters, fish style" {
+  # Given a path, with a hidden directory in it
+  string='~/projects/.config/mine/src'
+
+  # When we shorten it just enough, and then too much for that
+  run -0 $TEST_FUNCTION shorten_cwd fish "$string" 18 /unused
+  test "$output" = '~/p/.c/mine/src'
+  run -0 $TEST_FUNCTION shorten_cwd fish "$string" 10 /unused
+
+  # Then
+  # - the directories on the left are cut down until it fits, with
+  #   the dot of a hidden one kept; the last one is never cut down
+  # - if cutting them all down isn't enough, it's shortened with an
+  #   ellipsis as well
+  test "$output" = '...c/m/src'
+}
+
+# --------------------------------------------------
+@test "shorten_cwd() keeps the first and the last directories" {
+  # Given a long path
+  string='/one/two/three/four/five/six'
+
+  # When we shorten it, and shorten it more
+  run -0 $TEST_FUNCTION shorten_cwd first_last "$string" 20 /unused
+  test "$output" = '/.../five/six'
+  run -0 $TEST_FUNCTION shorten_cwd first_last "$string" 10 /unused
+
+  # Then
+  # - the directories between the first and the last two are left
+  #   out, or all but the last one, if that doesn't fit either
+  test "$output" = '/.../six'
+}
+
+# --------------------------------------------------
+@test "shorten_cwd() cuts directories down to a unique prefix" {
+  # Given directories next to the ones in the path
+  dir="$(mktemp -d)"
+  mkdir -p "$dir/projects/mine/src" "$dir/projects/minor" "$dir/pictures" "$dir/public"
+
+  # When we shorten it
+  run -0 $TEST_FUNCTION shorten_cwd unique '~/projects/mine/src' 13 "$dir/projects/mine/src"
+
+  # Then
+  # - each directory is cut down to what tells it apart from the
+  #   ones next to it, and ~ is left as it is
+  test "$output" = '~/pr/mine/src'
+  rm -rf "$dir"
+}
+
 # --------------------------------------------------
 @test "are_escape_sequences_properly_formed() passes well-formed sequence" {
   # Given a valid escape sequence
@@ -465,6 +607,21 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   test "$output" -eq 5
 }
 
+# --------------------------------------------------
+@test "count_visible_chars() should count correctly (UTF-8)" {
+  # Given 
+  # - a string with a powerline glyph, a combining accent and an
+  #   emoji in it
+  string=' café 🚀'
+
+  # When we test 
+  run -0 $TEST_FUNCTION count_visible_chars  "$string"
+
+  # Then
+  # - the glyph takes one column, the accent none, and the emoji two
+  test "$output" -eq 9
+}
+
 # --------------------------------------------------
 @test "count_visible_chars() should count correctly (attribute)" {
   # Given 
@@ -498,3 +655,33 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-prompt2-utils"
   test "$output" -eq $(tput cols)
 }
     
+
+# --------------------------------------------------
+@test "parse_epoch_realtime reads \$EPOCHREALTIME, with either decimal mark" {
+  # When we parse timestamps as bash and zsh give them
+  run -0 $TEST_FUNCTION parse_epoch_realtime '1718000000.123456 /home'
+  test "$output" = '1718000000123456  /home'
+  run -0 $TEST_FUNCTION parse_epoch_realtime '1718000000,5'
+  test "$output" = '1718000000500000 '
+  run -0 $TEST_FUNCTION parse_epoch_realtime '1718000000.123456789'
+  test "$output" = '1718000000123456 '
+
+  # Then
+  # - a directory isn't one
+  run -0 $TEST_FUNCTION parse_epoch_realtime '/home'
+  test "$output" = '0 /home'
+}
+
+# --------------------------------------------------
+@test "format_duration shows the two largest units" {
+  run -0 $TEST_FUNCTION format_duration 850
+  test "$output" = '850ms'
+  run -0 $TEST_FUNCTION format_duration 42999
+  test "$output" = '42s'
+  run -0 $TEST_FUNCTION format_duration 83000
+  test "$output" = '1m23s'
+  run -0 $TEST_FUNCTION format_duration 7530000
+  test "$output" = '2h5m'
+  run -0 $TEST_FUNCTION format_duration 273600000
+  test "$output" = '3d4h'
+}
@@ -0,0 +1,477 @@
+#!/usr/bin/env bats  # -*- mode: shell-script -*-
+bats_require_minimum_version 1.5.0
+
+# To run a test manually:
+# cd path/to/project/root
+# bats test/test-prompt2.bats
+
+
+# Binary to test
+TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/prompt2"
+
+load test_helper_functions
+
+
+# --------------------------------------------------
+helper__write_config() {
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{CWD}@{SPC}|"
+cwd_type="home"
+[PROMPT.GIT]
+prompt="@{Repo.branch_name} @{CWD} $ "
+cwd_type="git"
+INI
+}
+
+
+# --------------------------------------------------
+@test "--serve renders a prompt for each request" {
+  # Given
+  # - a git repo, and / which isn't in one
+  helper__write_config
+  helper__new_repo_and_commit "newfile" "some text"
+  mkdir -p subdir
+  repo=$(pwd)
+
+  # When we send a request for each of them
+  # (NULs are shown as @, as bash can't hold them in a variable)
+  printf '%s\n' "5 0 /" "80 1 $repo/subdir" |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - each prompt is for its own directory and terminal width, and
+  #   ends with a NUL
+  test "$(cat output)" = "$(printf '/   |\n@%s +/subdir $ \n@' "$DEFAULT_GIT_BRANCH_NAME")"
+}
+
+# --------------------------------------------------
+@test "--serve answers a malformed request" {
+  # Given
+  helper__write_config
+
+  # When we send a request without a width or exit status
+  echo "$HOME" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - we're told, and it's still NUL-terminated
+  test "$(cat output)" = 'MALFORMED REQUEST $ @'
+}
+
+# --------------------------------------------------
+@test "--serve reads the environment sent with the requests" {
+  # Given
+  # - a prompt with the virtualenv, which prompt2 was started without
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="<@{Env.venv}> $ "
+INI
+  mkdir -p venv-a venv-b
+
+  # When the shell activates one virtualenv, then another, then none
+  printf '%s\n' "VIRTUAL_ENV=$HOME/venv-a" "80 0 /" "VIRTUAL_ENV=$HOME/venv-b" "80 0 /" "VIRTUAL_ENV=" "80 0 /" |
+    env -u VIRTUAL_ENV $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - each prompt has the virtualenv active when it was asked for
+  test "$(cat output)" = "$(printf '<venv-a> $ \n@<venv-b> $ \n@<> $ \n@')"
+}
+
+# --------------------------------------------------
+@test "--serve reads KUBECONFIG from the requests" {
+  # Given
+  # - a prompt with the kubernetes context, and two kubeconfigs
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="<@{K8S.context}> $ "
+INI
+  echo 'current-context: one' > one.yaml
+  echo 'current-context: two' > two.yaml
+
+  # When the shell switches from one to the other
+  printf '%s\n' "KUBECONFIG=$HOME/one.yaml" "80 0 /" "KUBECONFIG=$HOME/two.yaml" "80 0 /" |
+    env -u KUBECONFIG $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - each prompt has the context of the kubeconfig of its request
+  test "$(cat output)" = "$(printf '<one> $ \n@<two> $ \n@')"
+}
+
+# --------------------------------------------------
+@test "--compile bakes the SYS widgets into the prompts" {
+  # Given
+  # - a prompt with SYS and other widgets
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{SYS.username}:@{CWD} @{SYS.promptchar} "
+[PROMPT.GIT]
+prompt="@{SYS.username}:@{Repo.branch_name} $ "
+INI
+
+  # When we compile it
+  run -0 $TEST_FUNCTION --compile "$HOME/prompt2.ini"
+
+  # Then
+  # - only the other widgets are left
+  test "${lines[0]}" = "$USER:@{CWD} $(test $(id -u) = 0 && echo '#' || echo '$') "
+  test "${lines[1]}" = "$USER:@{Repo.branch_name} \$ "
+}
+
+# --------------------------------------------------
+@test "a compiled template renders the same prompt" {
+  # Given
+  # - a git repo, and a prompt with SYS and other widgets
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT.GIT]
+prompt="@{SYS.hostname} @{Repo.branch_name} @{CWD} $ "
+INI
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+  expected="$output"
+
+  # When we render the prompt with the compiled template
+  export PROMPT2_TEMPLATE=$($TEST_FUNCTION --compile "$HOME/prompt2.ini")
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+  unset PROMPT2_TEMPLATE
+
+  # Then
+  # - it's the same
+  test "$output" = "$expected"
+}
+
+# --------------------------------------------------
+@test "the render cache doesn't hide a change of state" {
+  # Given
+  # - a shared render cache, with a prompt rendered in it
+  export XDG_RUNTIME_DIR="$HOME"
+  cat > "$HOME/prompt2.ini" <<'INI'
+[SYSTEM]
+render_cache = 1
+[PROMPT.GIT]
+prompt="@{Repo.branch_name} $ "
+INI
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+  test -s "$HOME/prompt2-render.cache"
+
+  # When the branch changes
+  git checkout -b featureBranch
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+
+  # Then
+  # - the prompt does too
+  [[ "$output" == *"featureBranch \$ "* ]]
+
+  # ... and back again, from the cache
+  git checkout "$DEFAULT_GIT_BRANCH_NAME"
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+  [[ "$output" == *"$DEFAULT_GIT_BRANCH_NAME \$ "* ]]
+}
+
+# --------------------------------------------------
+@test "widget tokens ignore case, and unknown ones are left as they are" {
+  # Given
+  # - a prompt with the same widget in different cases, and a widget
+  #   prompt2 doesn't know
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{REPO.Name}@{repo.name} @{Nope} $ "
+[repo.name]
+string_inactive="-"
+INI
+
+  # When we render it outside a git repo
+  echo "80 0 /" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  test "$(cat output)" = "$(printf -- '-- @{Nope} $ \n@')"
+}
+
+# --------------------------------------------------
+@test "the AWS token minutes are active when the token is about to expire" {
+  # Given
+  # - no AWS token at all, so there are no minutes left
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{aws.token_remaining_minutes} $ "
+[aws.token_remaining_minutes]
+string_active="(%s left)"
+string_inactive="(%s)"
+INI
+
+  # When
+  echo "80 0 /" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  test "$(cat output)" = "$(printf '(-1 left) $ \n@')"
+}
+
+# --------------------------------------------------
+@test "the right prompt follows the prompt, after a NUL" {
+  # Given
+  # - a right prompt, which the git prompt falls back on
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{CWD} $ "
+[PROMPT.RIGHT]
+prompt="[@{CWD}]"
+INI
+
+  # When we render it in a wide terminal, and in one with only a
+  # column left over by the prompt
+  printf '%s\n' "80 0 /" "12 0 /usr/lib" |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - each prompt is followed by its right prompt, which only has the
+  #   room the prompt leaves on its last line
+  test "$(cat output)" = "$(printf '/ $ \n@[/]@/usr/lib $ \n@[]@')"
+}
+
+# --------------------------------------------------
+@test "--compile bakes the SYS widgets into the right prompts too" {
+  # Given
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="$ "
+[PROMPT.GIT.RIGHT]
+prompt="@{SYS.username} @{Repo.branch_name}"
+INI
+
+  # When we compile it
+  $TEST_FUNCTION --compile "$HOME/prompt2.ini" > template
+
+  # Then
+  # - the right prompts follow the prompts; the default one is empty
+  test "$(sed -n 3p template)" = ""
+  test "$(sed -n 4p template)" = "$USER @{Repo.branch_name}"
+
+  # ... and a prompt rendered with the template has its right prompt
+  PROMPT2_TEMPLATE="$(cat template)" $TEST_FUNCTION "$HOME/prompt2.ini" | tr '\0' '@' > output
+  test "$(cat output)" = "$(printf '$ \n@')"
+}
+
+# --------------------------------------------------
+@test "the shell in [SYSTEM] picks how the prompt is written" {
+  # Given
+  # - a prompt with a colour, for tmux
+  cat > "$HOME/prompt2.ini" <<'INI'
+[SYSTEM]
+shell = tmux
+[PROMPT]
+prompt="%{bold}#@{CWD}%{} "
+INI
+
+  # When
+  echo "80 0 /" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - it's in tmux's own syntax, without the newline at the end
+  test "$(cat output)" = '#[bold]##/#[default] @'
+
+  # ... and a shell prompt2 doesn't know is an error
+  sed -i 's/tmux/tcsh/' "$HOME/prompt2.ini"
+  run $TEST_FUNCTION "$HOME/prompt2.ini"
+  test "${lines[0]}" = "INVALID INI FILE"
+}
+
+# --------------------------------------------------
+@test "widgets give way by priority when a line doesn't fit" {
+  # Given
+  # - a branch widget which may be dropped, and a CWD which gives
+  #   way first, but no further than five columns
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{CWD} @{Repo.branch_name}@{SPC}|"
+[Repo.branch_name]
+string_inactive="(no branch)"
+min_width=0
+[CWD]
+priority=-1
+min_width=5
+INI
+
+  # When we render it in a wide terminal, and in a narrow one
+  printf '%s\n' "30 0 /usr/lib" "15 0 /usr/lib" |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - in the wide one, the SPC fills the line
+  # - in the narrow one, the CWD is shortened to five columns, and as
+  #   that's not enough, the branch widget is dropped
+  test "$(cat output)" = "$(printf '/usr/lib (no branch)         |\n@...ib         |\n@')"
+
+  # ... and without the min_width, shortening the CWD is enough
+  sed -i '/min_width=5/d' "$HOME/prompt2.ini"
+  echo "15 0 /usr/lib" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+  test "$(cat output)" = "$(printf '.. (no branch)|\n@')"
+}
+
+# --------------------------------------------------
+@test "cwd_shorten picks how the CWD is shortened to fit" {
+  # Given
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{CWD} $ "
+cwd_type = full
+cwd_shorten = fish
+INI
+
+  # When there isn't room for all of it
+  echo "13 0 /usr/share/doc" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - the directories on the left are cut down to their first letters
+  test "$(cat output)" = "$(printf '/u/s/doc $ \n@')"
+
+  # ... and a way of shortening prompt2 doesn't know is an error
+  sed -i 's/fish/snip/' "$HOME/prompt2.ini"
+  run $TEST_FUNCTION "$HOME/prompt2.ini"
+  test "${lines[0]}" = "INVALID INI FILE"
+}
+
+# --------------------------------------------------
+@test "a serving prompt2 notices a new directory next to one cut to a unique prefix" {
+  # Given
+  # - a directory whose parents are cut down to unique prefixes
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{CWD} $ "
+cwd_shorten = unique
+INI
+  mkdir -p "$HOME/cs/projects/leaf"
+  dir=$(realpath "$HOME/cs/projects/leaf")
+  before=$(echo "16 0 $dir" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@')
+  test "$before" = "$(printf '~/c/p/leaf $ \n@')"
+
+  # When a directory with the same prefix is added between two requests
+  { echo "16 0 $dir"; sleep 0.5; mkdir "$HOME/cs/projectz"; echo "16 0 $dir"; } |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - the second prompt is the one a new prompt2 gives
+  after=$(echo "16 0 $dir" | $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@')
+  test "$after" != "$before"
+  test "$(cat output)" = "$before$after"
+}
+
+# --------------------------------------------------
+@test "a new project marker is noticed by a serving prompt2" {
+  # Given
+  # - a directory without a project marker
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="[@{Project.type}] $ "
+INI
+  mkdir -p myProject
+  dir=$(realpath myProject)
+
+  # When a marker is added between two requests for it
+  { echo "80 0 $dir"; sleep 0.5; touch "$dir/go.mod"; echo "80 0 $dir"; } |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - the second prompt shows it
+  test "$(cat output)" = "$(printf '[] $ \n@[go] $ \n@')"
+}
+
+# --------------------------------------------------
+@test "the markers noted on the way to the repo, and those above it" {
+  # Given
+  # - a git repo with a project marker, and a .nvmrc above it
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="[@{Project.type}|@{Env.node_version}] $ "
+[PROMPT.GIT]
+prompt="[@{Project.type}|@{Project.name}|@{Env.node_version}] $ "
+INI
+  mkdir -p outer/repo/sub
+  echo 'v20.1.0' > outer/.nvmrc
+  cd outer/repo
+  helper__new_repo_and_commit "go.mod" "module repo"
+  cd sub
+
+  # When we render a prompt in the repo and in the directory above it
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+  in_repo="$output"
+  cd ../..
+  run -0 $TEST_FUNCTION "$HOME/prompt2.ini"
+
+  # Then
+  # - the repo's marker is found inside it, and the .nvmrc in both
+  [[ "$in_repo" == *'[go|repo|20.1.0] $ '* ]]
+  [[ "$output" == *'[|20.1.0] $ '* ]]
+}
+
+# --------------------------------------------------
+@test "a serving prompt2 notices a change of kubernetes context" {
+  # Given
+  # - a kubeconfig
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{K8S.context}/@{K8S.namespace} $ "
+INI
+  unset KUBECONFIG
+  mkdir -p "$HOME/.kube"
+  printf 'current-context: dev\n' > "$HOME/.kube/config"
+
+  # When the context is switched between two requests
+  { echo "80 0 /"; sleep 0.5; printf 'current-context: prod\n' > "$HOME/.kube/config"; echo "80 0 /"; } |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - the second prompt shows it
+  test "$(cat output)" = "$(printf 'dev/ $ \n@prod/ $ \n@')"
+}
+
+# --------------------------------------------------
+@test "the last command's duration and exit status" {
+  # Given
+  # - widgets for both, active from a 5 second threshold
+  cat > "$HOME/prompt2.ini" <<'INI'
+[PROMPT]
+prompt="@{Cmd.duration}@{Cmd.exit_status}$ "
+[Cmd.duration]
+threshold_ms=5000
+string_active="took %s "
+string_inactive=""
+[Cmd.exit_status]
+string_active="[%s] "
+string_inactive=""
+INI
+  # (as bash gives the time, with the fraction kept)
+  seconds=${EPOCHREALTIME%[.,]*} fraction=${EPOCHREALTIME#*[.,]}
+
+  # When a slow command failed, a quick one succeeded, and we're not
+  # told when the last one started
+  printf '%s\n' "80 2 $((seconds - 83)).$fraction /" "80 0 $EPOCHREALTIME /" "80 0 /" |
+    $TEST_FUNCTION --serve "$HOME/prompt2.ini" | tr '\0' '@' > output
+
+  # Then
+  # - only the slow one's duration is shown, and only the failure
+  test "$(cat output)" = "$(printf 'took 1m23s [2] $ \n@$ \n@$ \n@')"
+
+  # ... and prompt2 is told the same by the bash snippet in README.org,
+  # here for a command which started 7 seconds ago and failed, then
+  # for one which didn't take long
+  mkdir "$HOME/bin"
+  ln -s "$TEST_FUNCTION" "$HOME/bin/prompt2"
+  cp "$HOME/prompt2.ini" "$HOME/.prompt2_config.ini"
+  run -0 env PATH="$HOME/bin:$PATH" bash -c '
+    trap '\''PROMPT2_COMMAND_START=${PROMPT2_COMMAND_START:-$EPOCHREALTIME}'\'' DEBUG
+    prompt_cmd() {
+      PS1=$(PROMPT2_EXIT_STATUS=$? PROMPT2_COMMAND_START=$PROMPT2_COMMAND_START prompt2)
+      unset PROMPT2_COMMAND_START
+    }
+    PROMPT_COMMAND=prompt_cmd
+
+    PROMPT2_COMMAND_START='"$((seconds - 7)).$fraction"'
+    false
+    $PROMPT_COMMAND
+    echo "$PS1@"
+    true
+    $PROMPT_COMMAND
+    echo "$PS1@"'
+  [[ "$output" == *'took 7s [1] $ @'* ]]
+  [[ "$output" == *$'\n$ @' ]]
+}
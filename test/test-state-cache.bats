@@ -0,0 +1,161 @@
+#!/usr/bin/env bats  # -*- mode: shell-script -*-
+bats_require_minimum_version 1.5.0
+
+# To run a test manually:
+# cd path/to/project/root
+# bats test/test-state-cache.bats
+
+
+# Binary to test
+TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-state-cache"
+
+load test_helper_functions
+
+
+# --------------------------------------------------
+@test "stored status is found by the next prompt" {
+  # Given
+  # - a repo, and a status cache which another shell has filled
+  export XDG_RUNTIME_DIR="$HOME"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 1 2 3
+
+  # When we look the status up
+  run -0 $TEST_FUNCTION load 60000
+
+  # Then
+  # - it's the stored status
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit      1
+  assert Repo.staged    1
+  assert Repo.modified  2
+  assert Repo.untracked 3
+}
+
+# --------------------------------------------------
+@test "status cache is keyed by repo" {
+  # Given
+  # - two repos, where only the first has a cached status
+  export XDG_RUNTIME_DIR="$HOME"
+  mkdir repo1 repo2
+  cd "$HOME/repo1"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 1 2 3
+  cd "$HOME/repo2"
+  helper__new_repo_and_commit "newfile" "some text"
+
+  # When we look the status of the second repo up
+  run -0 $TEST_FUNCTION load 60000
+
+  # Then
+  # - there is nothing cached
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit   0
+  assert Repo.staged -1
+}
+
+# --------------------------------------------------
+@test "status cache is invalidated by staging a file" {
+  # Given
+  # - a cached status
+  export XDG_RUNTIME_DIR="$HOME"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 0 0 0
+
+  # When the index changes
+  echo "other text" > newfile
+  git add newfile
+  run -0 $TEST_FUNCTION load 60000
+
+  # Then
+  # - the cached status is no longer used
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit 0
+}
+
+# --------------------------------------------------
+@test "status cache is invalidated by a commit" {
+  # Given
+  # - a cached status
+  export XDG_RUNTIME_DIR="$HOME"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 0 0 0
+
+  # When HEAD moves, without touching the index
+  git commit --allow-empty -m 'empty commit'
+  run -0 $TEST_FUNCTION load 60000
+
+  # Then
+  # - the cached status is no longer used
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit 0
+}
+
+# --------------------------------------------------
+@test "status cache entries expire" {
+  # Given
+  # - a cached status
+  export XDG_RUNTIME_DIR="$HOME"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 1 2 3
+
+  # When it's older than we accept
+  sleep 0.2
+  run -0 $TEST_FUNCTION load 100
+
+  # Then
+  # - the cached status is no longer used
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit 0
+}
+
+# --------------------------------------------------
+@test "a slot left busy by a writer which died is taken over" {
+  # Given
+  # - a cached status whose slot a writer took, and never gave back
+  #   (its counter, 16 bytes before the repo path, is left odd)
+  export XDG_RUNTIME_DIR="$HOME"
+  helper__new_repo_and_commit "newfile" "some text"
+  run -0 $TEST_FUNCTION store 1 2 3
+  python3 - "$HOME/prompt2-status.cache" "$PWD" <<'PY'
+import sys
+with open(sys.argv[1], 'r+b') as cache:
+    data = cache.read()
+    seq = data.find(sys.argv[2].encode() + b'\0') - 16
+    cache.seek(seq)
+    cache.write((int.from_bytes(data[seq:seq + 4], 'little') | 1).to_bytes(4, 'little'))
+PY
+
+  # When we store a status straight away, and again a little later
+  run -0 $TEST_FUNCTION store 4 5 6
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.stored 0
+
+  sleep 1.2
+  run -0 $TEST_FUNCTION store 4 5 6
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.stored 1
+
+  # Then
+  # - the slot is usable again
+  run -0 $TEST_FUNCTION load 60000
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.hit      1
+  assert Repo.staged    4
+}
+
+# --------------------------------------------------
+@test "no status cache without XDG_RUNTIME_DIR" {
+  # Given
+  # - no runtime dir
+  unset XDG_RUNTIME_DIR
+  helper__new_repo_and_commit "newfile" "some text"
+
+  # When we try to store the status
+  run -0 $TEST_FUNCTION store 1 2 3
+
+  # Then
+  # - nothing is stored
+  echo "$output" > "$HOME/assert-file"
+  assert Cache.stored 0
+}
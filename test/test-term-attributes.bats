@@ -70,6 +70,34 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-term-attributes"
   test "$output" = '\[\e[1;38;2;255;255;0m\]'
 }
 
+# --------------------------------------------------
+@test "get_attribute_combo() downsamples 24-bit colours to 256 colours" {
+  # Given
+  # - an attribute with a named and an RGB colour, and a style
+  attr='bold,fg-orange,bg-rgb-0;0;139'
+
+  # When we test for a 256 colour terminal
+  run -0 $TEST_FUNCTION get_attribute_combo_at_depth 256 "$attr"
+
+  # Then
+  # - the colours are the nearest of the 256, the style is kept
+  test "$output" = '\[\e[1;38;5;214;48;5;18m\]'
+}
+
+# --------------------------------------------------
+@test "get_attribute_combo() downsamples 24-bit and 256 colours to 16 colours" {
+  # Given
+  # - an attribute with RGB colours, and a basic one
+  attr='fg-rgb-255;255;255,bg-rgb-0;0;139,fg c3'
+
+  # When we test for a 16 colour terminal
+  run -0 $TEST_FUNCTION get_attribute_combo_at_depth 16 "$attr"
+
+  # Then
+  # - the RGB colours are the nearest basic ones, the basic one is kept
+  test "$output" = '\[\e[97;44;33m\]'
+}
+
 # --------------------------------------------------
 @test "get_attribute_combo() with invalid attribute should fail" {
   # Given 
@@ -172,3 +200,52 @@ TEST_FUNCTION="$BATS_TEST_DIRNAME/../bin/test-term-attributes"
   test "$output" =  'UNKNOWN_ATTRTHIS is a bold string \[\e[0m\]\[\e[2m\]THIS is a dim string\[\e[0m\]'
 }
 
+
+# --------------------------------------------------
+@test "get-attribute --batch writes an escape sequence for each line" {
+  # Given
+  # - attributes, one per line, and one which doesn't exist
+  get_attribute="$BATS_TEST_DIRNAME/../bin/get-attribute"
+  combos='bold
+fg blue, bg white
+RANDOMSTRING'
+
+  # When we test
+  run -0 $get_attribute --batch <<< "$combos"
+
+  # Then
+  # - there's a line for each of them, in the same order
+  test "${lines[0]}" = '\[\e[1m\]'
+  test "${lines[1]}" = '\[\e[34;47m\]'
+  test "${lines[2]}" = 'UNKNOWN_ATTR'
+
+  # ... and with -0, they're ended by NULs both ways
+  result="$(printf 'bold\0dim\0' | $get_attribute --batch -0 | tr '\0' '@')"
+  test "$result" = '\[\e[1m\]@\[\e[2m\]@'
+}
+
+# --------------------------------------------------
+@test "get-attribute --nearest finds the names of colours" {
+  get_attribute="$BATS_TEST_DIRNAME/../bin/get-attribute"
+
+  # When we look up a colour which has names, and one which hasn't
+  run -0 $get_attribute --nearest '#ff0000'
+  test "$output" = 'fg-red, fg-red1'
+  run -0 $get_attribute --nearest '#3a7bd5'
+
+  # Then
+  # - we get all the names of the nearest named colour
+  test "$output" = 'fg-royalblue'
+
+  # ... and an SGR code gives the attributes with that code, or the
+  # nearest background colour's names
+  run -0 $get_attribute --nearest '\[\e[34m\]'
+  test "$output" = 'fg blue, fg c4'
+  run -0 $get_attribute --nearest '48;2;10;10;10'
+  test "$output" = 'bg-gray4, bg-grey4'
+
+  # ... and colours can be looked up in a batch, with a line for each
+  run -0 $get_attribute --nearest --batch <<< $'38;5;208\nnot a colour'
+  test "${lines[0]}" = 'fg-darkorange'
+  test "${lines[1]}" = 'UNKNOWN_COLOUR'
+}
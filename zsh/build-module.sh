@@ -0,0 +1,51 @@
+#!/usr/bin/env bash
+# build-module.sh — build zsh with the zsh/prompt2 module
+#
+# zsh modules are built as part of zsh, so this copies the module
+# into a zsh source tree, and configures and builds zsh with
+# bin/libprompt2.a (and the libraries it needs) linked in.
+#
+# Usage:
+#   zsh/build-module.sh path/to/zsh-source [configure options...]
+#
+# then `make install` in the zsh source tree, and in ~/.zshrc:
+#   zmodload zsh/prompt2
+#   precmd() { prompt2_render -v PROMPT }
+
+set -euo pipefail
+
+SCRIPT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+ROOT_DIR=$(cd "$SCRIPT_DIR/.." && pwd)
+ZSH_SRC="${1:?usage: $0 path/to/zsh-source [configure options...]}"
+shift
+
+# Where libgit2, json-c and iniparser are (as in the Makefile)
+INCLUDE_DIR="${INCLUDE_DIR:-/opt/homebrew/include}"
+LIB_DIR="${LIB_DIR:-/opt/homebrew/lib}"
+
+# ── Pre-flight ─────────────────────────────────────────────────────────────
+if [[ ! -f "$ZSH_SRC/Src/zsh.h" ]]; then
+  echo "'$ZSH_SRC' doesn't look like a zsh source tree" >&2
+  exit 1
+fi
+
+# ── libprompt2.a ───────────────────────────────────────────────────────────
+make -C "$ROOT_DIR" INCLUDE_DIR="$INCLUDE_DIR" LIB_DIR="$LIB_DIR" libprompt2
+
+# ── Module ─────────────────────────────────────────────────────────────────
+cp "$SCRIPT_DIR/prompt2.c" "$SCRIPT_DIR/prompt2.mdd" "$ZSH_SRC/Src/Modules/"
+
+cd "$ZSH_SRC"
+[[ -x configure ]] || ./Util/preconfig
+# -Bsymbolic keeps the module's own functions from binding to zsh's
+# ones of the same name (macOS' two-level namespace does this anyway)
+SYMBOLIC="-Wl,-Bsymbolic"
+[[ "$(uname)" == Darwin ]] && SYMBOLIC=""
+CPPFLAGS="-I$ROOT_DIR/src -I$INCLUDE_DIR ${CPPFLAGS:-}" \
+LDFLAGS="-L$LIB_DIR $SYMBOLIC ${LDFLAGS:-}" \
+LIBS="$ROOT_DIR/bin/libprompt2.a -lgit2 -ljson-c -liniparser -lpthread ${LIBS:-}" \
+  ./configure --enable-dynamic "$@"
+make
+
+echo
+echo "Built $ZSH_SRC/Src/Modules/prompt2.so"
@@ -0,0 +1,225 @@
+/*
+ * zsh/prompt2
+ *
+ * A zsh module which renders the prompt inside the shell, instead of
+ * forking and exec'ing prompt2 (and loading its shared libraries)
+ * for every prompt.
+ *
+ * The configuration and the terminal attributes are loaded once and
+ * kept for the life of the shell, with the SYS widgets compiled in
+ * (see compile_configuration()); the configuration is reloaded when
+ * the INI file changes. libgit2 is initialised the first time a
+ * prompt needs it.
+ *
+ * Usage:
+ *   zmodload zsh/prompt2
+ *   precmd() { prompt2_render -v PROMPT -r RPROMPT }
+ *
+ *   prompt2_render [-v var] [-r var] [config-file]
+ *     -v var       set var to the prompt, instead of printing it
+ *     -r var       set var to the right prompt (empty if there isn't
+ *                  one in the configuration)
+ *     config-file  the INI file to use, instead of
+ *                  $HOME/.prompt2_config.ini
+ *
+ * For @{Cmd.duration}, set $PROMPT2_COMMAND_START to $EPOCHREALTIME
+ * (from zsh/datetime) in preexec, and unset it after rendering.
+ *
+ * This file is built as part of zsh: see build-module.sh.
+ */
+
+#include "prompt2.mdh"
+#include "prompt2.pro"
+
+#include <sys/stat.h>
+
+#include "constants.h"
+#include "prompt2-utils.h"
+#include "render.h"
+#include "term-attributes.h"
+
+/**
+   Width of terminal if $COLUMNS isn't set
+*/
+#define DEFAULT_TERMINAL_WIDTH 80
+
+
+/**
+   What is kept between prompts
+*/
+static struct ConfigRoot config;
+static int config_loaded = 0;
+static char *config_path = NULL;
+static time_t config_mtime;
+static off_t config_size;
+static dictionary *attribute_dict = NULL;
+
+/**
+   The prompt is rendered into this; converting it for zsh can make it
+   up to three times longer
+*/
+static char prompt[PROMPT_MAX_LEN * 3 + 1];
+
+
+/**
+ * Helper: Load the configuration, unless the one already loaded is
+ * from the same file, and the file hasn't changed since.
+ *
+ * @return SUCCESS, or the return value of load_configuration()
+ */
+static int
+__load_config(const char *path, char *error, size_t error_size)
+{
+    struct stat sb;
+    if (stat(path, &sb) != 0) {
+        memset(&sb, 0, sizeof(sb));
+    }
+
+    if (config_loaded && strcmp(path, config_path) == 0 &&
+        sb.st_mtime == config_mtime && sb.st_size == config_size) {
+        return SUCCESS;
+    }
+
+    if (config_loaded) {
+        free_configuration(&config);
+        config_loaded = 0;
+    }
+    zsfree(config_path);
+    config_path = ztrdup(path);
+    config_mtime = sb.st_mtime;
+    config_size = sb.st_size;
+
+    int retval = load_configuration(&config, path, error, error_size);
+    if (retval != SUCCESS) {
+        // a partially loaded configuration has to be freed too
+        free_configuration(&config);
+        return retval;
+    }
+    config_loaded = 1;
+
+    if (!attribute_dict) {
+        attribute_dict = create_attribute_dict();
+    }
+    compile_configuration(&config, attribute_dict);
+    return SUCCESS;
+}
+
+
+/**/
+static int
+bin_prompt2_render(char *nam, char **args, Options ops, UNUSED(int func))
+{
+    char path[PATH_MAX];
+    if (*args) {
+        snprintf(path, sizeof(path), "%s", *args);
+    }
+    else {
+        snprintf(path, sizeof(path), "%s/.prompt2_config.ini", getsparam("HOME") ?: ".");
+    }
+
+    struct OutputSink sink = sink_to_buffer(prompt, sizeof(prompt));
+    int retval;
+    char error[PATH_MAX + 64];
+    if (__load_config(path, error, sizeof(error)) != SUCCESS) {
+        sink_emit(&sink, error, strlen(error));
+        retval = ERROR;
+    }
+    else {
+        zlong columns = getiparam("COLUMNS");
+        char *command_start = getsparam("PROMPT2_COMMAND_START");
+        struct RenderRequest request = {
+            .cwd            = NULL,
+            .terminal_width = columns > 0 ? (int) columns : DEFAULT_TERMINAL_WIDTH,
+            .exit_status    = lastval,
+            .command_start  = command_start ? parse_epoch_realtime(command_start, NULL) : 0,
+        };
+        retval = render_prompt(&config, SHELL_ZSH, &request, attribute_dict, &sink);
+    }
+
+    if (OPT_ISSET(ops, 'r')) {
+        // the right prompt follows the prompt, after a NUL
+        size_t length = strlen(prompt);
+        const char *right = length < sink.length ? prompt + length + 1 : "";
+        setsparam(OPT_ARG(ops, 'r'), ztrdup(right));
+    }
+    if (OPT_ISSET(ops, 'v')) {
+        setsparam(OPT_ARG(ops, 'v'), ztrdup(prompt));
+    }
+    else {
+        fputs(prompt, stdout);
+    }
+
+    if (retval != SUCCESS) {
+        zwarnnam(nam, "could not render the prompt");
+        return 1;
+    }
+    return 0;
+}
+
+
+static struct builtin bintab[] = {
+    BUILTIN("prompt2_render", 0, bin_prompt2_render, 0, 1, 0, "r:v:", NULL),
+};
+
+static struct features module_features = {
+    bintab, sizeof(bintab)/sizeof(*bintab),
+    NULL, 0,
+    NULL, 0,
+    NULL, 0,
+    0
+};
+
+
+/**/
+int
+setup_(UNUSED(Module m))
+{
+    return 0;
+}
+
+/**/
+int
+features_(Module m, char ***features)
+{
+    *features = featuresarray(m, &module_features);
+    return 0;
+}
+
+/**/
+int
+enables_(Module m, int **enables)
+{
+    return handlefeatures(m, &module_features, enables);
+}
+
+/**/
+int
+boot_(UNUSED(Module m))
+{
+    return 0;
+}
+
+/**/
+int
+cleanup_(Module m)
+{
+    return setfeatureenables(m, &module_features, NULL);
+}
+
+/**/
+int
+finish_(UNUSED(Module m))
+{
+    if (config_loaded) {
+        free_configuration(&config);
+        config_loaded = 0;
+    }
+    zsfree(config_path);
+    config_path = NULL;
+    if (attribute_dict) {
+        free_attribute_dict(attribute_dict);
+        attribute_dict = NULL;
+    }
+    render_shutdown();
+    return 0;
+}